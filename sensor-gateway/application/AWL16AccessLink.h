@@ -27,23 +27,35 @@ namespace SensorGateway {
     using AWL16SpiritStructures = Sensor::Spirit::Structures<
             AWL16Structures::AWLMessageDefinition,
             AWL16Structures::AWLRawDataDefinition,
-            AWL16Structures::AWLCommandDefinition
+            AWL16Structures::AWLCommandDefinition,
+            DataFlow::NumericEncoding::AWLTrackEncoding
             >;
 
-    class AWL16AccessLink final : public SensorAccessLink<AWL16Structures, AWL16SpiritStructures> {
+    /**
+     * @note The translation and sensor communication strategies are known at compile time, only the server
+     * communication strategy is given at runtime.
+     */
+    using AWL16SensorAccessLink = SensorAccessLink<AWL16Structures, AWL16SpiritStructures,
+            ServerCommunication::ServerCommunicationStrategy<AWL16SpiritStructures>,
+            DataTranslation::AWLTranslationStrategy,
+            SensorCommunication::KvaserCanCommunicationStrategy>;
+
+    class AWL16AccessLink final : public AWL16SensorAccessLink {
 
     protected:
 
-        using super = SensorAccessLink<AWL16Structures, AWL16SpiritStructures>;
+        using super = AWL16SensorAccessLink;
 
         using super::ServerCommunicationStrategy;
 
     public:
 
-        explicit AWL16AccessLink(ServerCommunicationStrategy* serverCommunicationStrategy)
+        explicit AWL16AccessLink(ServerCommunicationStrategy* serverCommunicationStrategy,
+                                 DataFlow::WorkStealingExecutor* executor = nullptr)
                 : super(serverCommunicationStrategy,
                         &awlTranslationStrategy,
-                        &kvaserCanCommunicationStrategy) {}
+                        &kvaserCanCommunicationStrategy,
+                        executor) {}
 
         ~AWL16AccessLink() noexcept = default;
 
@@ -28,22 +28,34 @@ namespace SensorGateway {
     using GuardianSpiritStructures = Sensor::Spirit::Structures<
             GuardianStructures::GuardianMessageDefinition,
             GuardianStructures::GuardianRawDataDefinition,
-            GuardianStructures::GuardianCommandDefinition>;
+            GuardianStructures::GuardianCommandDefinition,
+            DataFlow::NumericEncoding::GuardianTrackEncoding>;
 
-    class GuardianAccessLink final : public SensorAccessLink<GuardianStructures, GuardianSpiritStructures> {
+    /**
+     * @note The translation and sensor communication strategies are known at compile time, only the server
+     * communication strategy is given at runtime.
+     */
+    using GuardianSensorAccessLink = SensorAccessLink<GuardianStructures, GuardianSpiritStructures,
+            ServerCommunication::ServerCommunicationStrategy<GuardianSpiritStructures>,
+            DataTranslation::GuardianTranslationStrategy,
+            SensorCommunication::GuardianUSBCommunicationStrategy>;
+
+    class GuardianAccessLink final : public GuardianSensorAccessLink {
 
     protected:
 
-        using super = SensorAccessLink<GuardianStructures, GuardianSpiritStructures>;
+        using super = GuardianSensorAccessLink;
 
         using super::ServerCommunicationStrategy;
 
     public:
 
-        explicit GuardianAccessLink(ServerCommunicationStrategy* serverCommunicationStrategy)
+        explicit GuardianAccessLink(ServerCommunicationStrategy* serverCommunicationStrategy,
+                                    DataFlow::WorkStealingExecutor* executor = nullptr)
                 : super(serverCommunicationStrategy,
                         &guardianTranslationStrategy,
-                        &guardianUSBCommunicationStrategy) {}
+                        &guardianUSBCommunicationStrategy,
+                        executor) {}
 
         ~GuardianAccessLink() noexcept = default;
 
@@ -23,7 +23,16 @@ namespace SensorGateway {
 
     // TODO: Use `type_index` to facilitate the mapping to the correct SensorAccessLink type : https://en.cppreference.com/w/cpp/types/type_index
     // TODO: Using things like `enable_if<>, handle different sensors when there is or not RawData or fetching in bulk`
-    template<class SENSOR_STRUCTURES, class SERVER_STRUCTURES>
+    /**
+     * @brief Links a sensor to a server through the translation of its data.
+     * The strategies are abstract by default, so that any implementation, e.g.: a mock, can be given at runtime. When
+     * given final concrete strategy types instead, every hop of the pipeline, from the schedulers to the strategies, is
+     * resolved at compile time.
+     */
+    template<class SENSOR_STRUCTURES, class SERVER_STRUCTURES,
+            class SERVER_COMMUNICATION_STRATEGY = ServerCommunication::ServerCommunicationStrategy<SERVER_STRUCTURES>,
+            class DATA_TRANSLATION_STRATEGY = DataTranslation::DataTranslationStrategy<SENSOR_STRUCTURES, SERVER_STRUCTURES>,
+            class SENSOR_COMMUNICATION_STRATEGY = SensorCommunication::SensorCommunicationStrategy<SENSOR_STRUCTURES>>
     class SensorAccessLink : public DataFlow::DataSink<ErrorHandling::SensorAccessLinkError> {
 
     protected:
@@ -34,38 +43,53 @@ namespace SensorGateway {
         using ServerMessage = typename SERVER_STRUCTURES::Message;
         using ServerRawData = typename SERVER_STRUCTURES::RawData;
 
-        using ServerCommunicator = SensorAccessLinkElement::ServerCommunicator<SERVER_STRUCTURES>;
-        using ServerCommunicationStrategy = ServerCommunication::ServerCommunicationStrategy<SERVER_STRUCTURES>;
-        using ServerCommunicatorMessageScheduler = DataFlow::DataProcessingScheduler<ServerMessage, ServerCommunicator, 1>;
-        using ServerCommunicatorRawDataScheduler = DataFlow::DataProcessingScheduler<ServerRawData, ServerCommunicator, 1>;
-
-        using DataTranslator = SensorAccessLinkElement::DataTranslator<SENSOR_STRUCTURES, SERVER_STRUCTURES>;
-        using DataTranslationStrategy = DataTranslation::DataTranslationStrategy<SENSOR_STRUCTURES, SERVER_STRUCTURES>;
-        using TranslatorMessageScheduler = DataFlow::DataProcessingScheduler<SensorMessage, DataTranslator, 1>;
-        using TranslatorRawDataScheduler = DataFlow::DataProcessingScheduler<SensorRawData, DataTranslator, 1>;
-
-        using SensorCommunicator = SensorAccessLinkElement::SensorCommunicator<SENSOR_STRUCTURES>;
-        using SensorCommunicationStrategy = SensorCommunication::SensorCommunicationStrategy<SENSOR_STRUCTURES>;
+        using ServerCommunicationStrategy = SERVER_COMMUNICATION_STRATEGY;
+        using ServerCommunicator =
+        SensorAccessLinkElement::ServerCommunicator<SERVER_STRUCTURES, ServerCommunicationStrategy>;
+        using ServerCommunicatorMessageScheduler =
+        DataFlow::DataProcessingScheduler<ServerMessage, ServerCommunicator, 1, DataFlow::SpinThenYieldWaitStrategy>;
+        using ServerCommunicatorRawDataScheduler =
+        DataFlow::DataProcessingScheduler<ServerRawData, ServerCommunicator, 1, DataFlow::SpinThenYieldWaitStrategy>;
+
+        using DataTranslationStrategy = DATA_TRANSLATION_STRATEGY;
+        using DataTranslator =
+        SensorAccessLinkElement::DataTranslator<SENSOR_STRUCTURES, SERVER_STRUCTURES, DataTranslationStrategy>;
+        using TranslatorMessageScheduler =
+        DataFlow::DataProcessingScheduler<SensorMessage, DataTranslator, 1, DataFlow::SpinThenYieldWaitStrategy>;
+        using TranslatorRawDataScheduler =
+        DataFlow::DataProcessingScheduler<SensorRawData, DataTranslator, 1, DataFlow::SpinThenYieldWaitStrategy>;
+
+        using SensorCommunicationStrategy = SENSOR_COMMUNICATION_STRATEGY;
+        using SensorCommunicator = SensorAccessLinkElement::SensorCommunicator<SENSOR_STRUCTURES, SensorCommunicationStrategy>;
 
         using Error = ErrorHandling::SensorAccessLinkError;
-        using ThisClass = SensorAccessLink<SENSOR_STRUCTURES, SERVER_STRUCTURES>;
-        using ErrorScheduler = DataFlow::DataProcessingScheduler<Error, ThisClass, 3>;
+        using ThisClass = SensorAccessLink<SENSOR_STRUCTURES, SERVER_STRUCTURES, SERVER_COMMUNICATION_STRATEGY,
+                DATA_TRANSLATION_STRATEGY, SENSOR_COMMUNICATION_STRATEGY>;
+        using ErrorScheduler = DataFlow::DataProcessingScheduler<Error, ThisClass, 3, DataFlow::BlockingWaitStrategy,
+                DataFlow::StrictPriorityInputSelectionPolicy<3>>;
 
     public:
+        /**
+         * @param executor when given, the schedulers of the link are executed as tasks on it instead of owning a thread
+         * each, e.g.: DataFlow::WorkStealingExecutor::shared()
+         */
         explicit SensorAccessLink(ServerCommunicationStrategy* serverCommunicationStrategy,
                                   DataTranslationStrategy* dataTranslationStrategy,
-                                  SensorCommunicationStrategy* sensorCommunicationStrategy) :
+                                  SensorCommunicationStrategy* sensorCommunicationStrategy,
+                                  DataFlow::WorkStealingExecutor* executor = nullptr) :
                 serverCommunicationStrategy(serverCommunicationStrategy),
                 dataTranslationStrategy(dataTranslationStrategy),
                 sensorCommunicationStrategy(sensorCommunicationStrategy),
                 serverCommunicator(serverCommunicationStrategy),
                 dataTranslator(dataTranslationStrategy),
                 sensorCommunicator(sensorCommunicationStrategy),
-                translatorMessageScheduler(&dataTranslator),
-                translatorRawDataScheduler(&dataTranslator),
-                serverCommunicatorMessageScheduler(&serverCommunicator),
-                serverCommunicatorRawDataScheduler(&serverCommunicator),
-                errorScheduler(this) // TODO : Change "this" for the SensorAccessLinkErrorHandler
+                translatorMessageScheduler(&dataTranslator, executor),
+                translatorRawDataScheduler(&dataTranslator, executor),
+                serverCommunicatorMessageScheduler(&serverCommunicator, executor),
+                serverCommunicatorRawDataScheduler(&serverCommunicator, executor),
+                // Sensor, translator and server error priorities, in linkElements order. A flood of translation
+                // errors cannot delay a sensor error by more than one batch.
+                errorScheduler(this, {{2, 0, 1}}, executor) // TODO : Change "this" for the SensorAccessLinkErrorHandler
         {}
 
         ~SensorAccessLink() noexcept {
@@ -26,6 +26,16 @@ namespace Metrics {
 namespace DataFlow {
     uint8_t const NUMBER_OF_CONCURRENT_INPUT_FOR_SENSOR_ACCESS_LINK_ELEMENTS = 1;
     size_t const RING_BUFFER_SIZE = 256;
+    // At most one error per failed read or send, drained by the error handlers at every wake up
+    size_t const ERROR_RING_BUFFER_SIZE = 32;
+    size_t const CACHE_LINE_SIZE = 64;
+    size_t const MAXIMUM_NUMBER_OF_DATA_PER_BATCH = 32;
+    uint8_t const HIGH_WATERMARK_PERCENTAGE = 75;
+    uint8_t const LOW_WATERMARK_PERCENTAGE = 25;
+    uint8_t const RAW_DATA_POLLING_DECIMATION_UNDER_BACK_PRESSURE = 8;
+    uint8_t const MAXIMUM_NUMBER_OF_CONSUMERS_PER_RING_BUFFER = 8;
+    uint8_t const MAXIMUM_NUMBER_OF_CONFLATED_KEYS = 16;
+    size_t const MAXIMUM_NUMBER_OF_FREE_POOLED_BLOCKS = 256;
 };
 
 namespace CommandId {
@@ -25,6 +25,14 @@ namespace ExceptionMessage {
     static auto CONSTANT_SIZED_POINTER_LIST_ILLEGAL_REMOVAL_OF_POINTER = "Illegal removal of pointer: the ConstantSizedPointerList does not contain the pointer.";
 
     static auto RING_BUFFER_ILLEGAL_CONSUMPTION_ON_WRITER_LOCATION_MESSAGE = "Illegal consumption, execution should not reach this point. The calling entity should not be allowed to proceed to this call. Data might have been lost";
+    static auto RING_BUFFER_ILLEGAL_LINKING_MAXIMUM_NUMBER_OF_CONSUMERS_REACHED = "Illegal linking attempt between RingBuffer and Consumer: The maximum number of Consumer has already been reached for this RingBuffer.";
+
+    static auto SHARED_MEMORY_SEGMENT_CREATION_FAILED = "Shared memory segment creation failed: the named segment could not be created with the requested size.";
+    static auto SHARED_MEMORY_SEGMENT_ALREADY_EXISTS = "Shared memory segment creation failed: a segment with this name already exists, it is either in use or left by a crashed creator.";
+    static auto SHARED_MEMORY_SEGMENT_OPENING_FAILED = "Shared memory segment opening failed: no segment of this name and size has been created.";
+    static auto SHARED_MEMORY_SEGMENT_MAPPING_FAILED = "Shared memory segment mapping failed: the segment could not be mapped in the process address space.";
+    static auto SHARED_MEMORY_RING_BUFFER_INCOMPATIBLE_LAYOUT = "Illegal attachment to SharedMemoryRingBuffer: the segment was not written by a SharedMemoryRingBuffer of the same slot type and capacity.";
+    static auto SHARED_MEMORY_RING_BUFFER_MAXIMUM_NUMBER_OF_READERS_REACHED = "Illegal attachment to SharedMemoryRingBuffer: The maximum number of SharedMemoryReader has already been reached for this SharedMemoryRingBuffer.";
 
     static auto DATA_PROCESSING_SCHEDULER_ILLEGAL_LINKING_SCHEDULER_HAS_BEEN_STOPPED = "Illegal linking attempt between DataProcessingScheduler and DataSourceBuffer: The DataProcessingScheduler has received the terminate order, no new DataSourceBuffer can be linked.";
     static auto DATA_PROCESSING_SCHEDULER_ILLEGAL_LINKING_OF_ALREADY_LINKED_BUFFER_MESSAGE = "Illegal linking attempt between DataProcessingScheduler and DataSourceBuffer: The DataSourceBuffer has already been linked.";
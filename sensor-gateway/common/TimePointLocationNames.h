@@ -17,13 +17,40 @@
 #ifndef SENSORGATEWAY_TIMEPOINTLOCATIONNAMES_H
 #define SENSORGATEWAY_TIMEPOINTLOCATIONNAMES_H
 
+#include <cstdint>
 #include <iostream>
 #include "ExceptionMessages.h"
 
 namespace Metrics {
+
+    /**
+     * @brief Interned identifier of the place a time point was taken at. The time points only carry this id, the name
+     * of the location is looked up in LocationNames when the time points are reported.
+     */
+    typedef uint16_t LocationId;
+
+    namespace Locations {
+
+        LocationId const UNSPECIFIED = 0;
+        LocationId const SERVER_COMMUNICATOR_SENDING = 1;
+    }
+
     namespace LocationNames {
 
+        static std::string const UNSPECIFIED;
         static std::string const SERVER_COMMUNICATOR_SENDING  = "ServerCommunicator:Transmission";
+        static std::string const UNREGISTERED = "Unregistered location";
+
+        inline std::string const& nameOf(LocationId const& location) noexcept {
+            switch (location) {
+                case Locations::UNSPECIFIED:
+                    return UNSPECIFIED;
+                case Locations::SERVER_COMMUNICATOR_SENDING:
+                    return SERVER_COMMUNICATOR_SENDING;
+                default:
+                    return UNREGISTERED;
+            }
+        }
     }
 }
 
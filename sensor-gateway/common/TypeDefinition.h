@@ -21,6 +21,7 @@
 #include <atomic>
 #include <future>
 #include <mutex>
+#include <condition_variable>
 #include <random>
 #include <functional>
 #include <algorithm>
@@ -33,6 +34,8 @@
 #include <limits>
 #include <chrono>
 #include <utility>
+#include <new>
+#include <type_traits>
 
 #include "hicpp/HighIntegrityThread.h"
 #include "TimePointLocationNames.h"
@@ -42,6 +45,8 @@ namespace {
 
     typedef std::mutex Mutex;
     typedef std::lock_guard<Mutex> LockGuard;
+    typedef std::unique_lock<Mutex> UniqueLock;
+    typedef std::condition_variable ConditionVariable;
 
     typedef std::atomic_uint8_t AtomicCounter;
     typedef std::atomic<bool> AtomicFlag;
@@ -77,6 +82,9 @@ namespace DataFlow {
     typedef double_t Speed;
     typedef uint16_t SensorId;
     typedef uint16_t TrackId;
+
+    typedef uint64_t SequenceNumber;
+    typedef std::atomic<SequenceNumber> AtomicSequenceNumber;
 };
 
 #endif //SENSORGATEWAY_TYPEDEFINITION_H
@@ -0,0 +1,119 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_BLOCKPOOL_HPP
+#define SENSORGATEWAY_BLOCKPOOL_HPP
+
+#include <memory>
+
+#include "sensor-gateway/common/ConstantValuesDefinition.h"
+
+namespace Container {
+
+    /**
+     * @brief Recycles heap blocks holding a T, so that a data too large to be moved cheaply can be owned through a
+     * pointer that a move only has to steal. The released blocks are kept, up to CAPACITY, to be handed back without
+     * allocating. Each type has its shared pool, the blocks can be acquired and released from any thread.
+     * @note The blocks are handed back with their last content, their new owner is expected to overwrite it.
+     */
+    template<class T, std::size_t CAPACITY = DataFlow::MAXIMUM_NUMBER_OF_FREE_POOLED_BLOCKS>
+    class BlockPool final {
+
+    public:
+
+        struct Recycler {
+            void operator()(T* block) const noexcept {
+                BlockPool::shared().release(block);
+            }
+        };
+
+        using Block = std::unique_ptr<T, Recycler>;
+
+        /**
+         * @note The shared pool is never destroyed, so that the objects with static storage duration can still release
+         * their blocks at exit.
+         */
+        static BlockPool& shared() {
+            static auto sharedPool = new BlockPool();
+            return *sharedPool;
+        }
+
+        /**
+         * @warning The BlockPools are intended to be used as const instances. They shouldn't be moved.
+         */
+        BlockPool(BlockPool&& other) noexcept = delete;
+
+        /**
+         * @warning The BlockPools are intended to be used as const instances. They shouldn't be copied.
+         */
+        BlockPool(BlockPool const& other) = delete;
+
+        /**
+         * @warning The BlockPools are intended to be used as const instances. They shouldn't be assigned.
+         */
+        BlockPool& operator=(BlockPool const& other) = delete;
+
+        /**
+         * @warning The BlockPools are intended to be used as const instances. They shouldn't be assigned.
+         */
+        BlockPool& operator=(BlockPool&& other) = delete;
+
+        Block acquireCopyOf(T const& content) {
+            auto block = acquire();
+            *block = content;
+            return block;
+        }
+
+        std::size_t fetchNumberOfFreeBlocks() {
+            LockGuard guard(poolMutex);
+            return numberOfFreeBlocks;
+        }
+
+    private:
+
+        BlockPool() : numberOfFreeBlocks(0) {}
+
+        Block acquire() {
+            {
+                LockGuard guard(poolMutex);
+                if (numberOfFreeBlocks != 0) {
+                    return Block(freeBlocks[--numberOfFreeBlocks]);
+                }
+            }
+            return Block(new T());
+        }
+
+        void release(T* block) noexcept {
+            {
+                LockGuard guard(poolMutex);
+                if (numberOfFreeBlocks != CAPACITY) {
+                    freeBlocks[numberOfFreeBlocks++] = block;
+                    return;
+                }
+            }
+            delete block;
+        }
+
+        Mutex poolMutex;
+
+        std::array<T*, CAPACITY> freeBlocks;
+
+        std::size_t numberOfFreeBlocks;
+    };
+}
+
+#endif //SENSORGATEWAY_BLOCKPOOL_HPP
@@ -0,0 +1,137 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_CONSTANTSIZEDATOMICBITSET_HPP
+#define SENSORGATEWAY_CONSTANTSIZEDATOMICBITSET_HPP
+
+#include "sensor-gateway/common/TypeDefinition.h"
+
+namespace Container {
+
+    using Bitmask = uint64_t;
+
+    /**
+     * @return the index of the first bit set in the SIZE first bits of the bitmask, starting from the start index and
+     * wrapping around, or SIZE when none is set.
+     */
+    template<std::size_t SIZE>
+    inline std::size_t findFirstSetBitFrom(Bitmask bitmask, std::size_t start) noexcept {
+        auto const sizeMask = ~Bitmask(0) >> (std::numeric_limits<Bitmask>::digits - SIZE);
+        bitmask &= sizeMask;
+        if (bitmask == 0) {
+            return SIZE;
+        }
+        auto const fromStart = bitmask & (sizeMask << start);
+        auto const candidates = fromStart != 0 ? fromStart : bitmask;
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(candidates));
+#else
+        std::size_t index = 0;
+        while ((candidates & (Bitmask(1) << index)) == 0) {
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    inline bool isBitSet(Bitmask bitmask, std::size_t index) noexcept {
+        return (bitmask & (Bitmask(1) << index)) != 0;
+    }
+
+    /**
+     * @brief Constant sized set of indexes, held in a single atomic bitmask.
+     * Every operation is a single atomic operation : no lock is taken and no search is made over the indexes.
+     * @template <std::size_t SIZE> refers to the SIZE indexes, from 0 to SIZE - 1, that this Bitset can hold.
+     */
+    template<std::size_t SIZE>
+    class ConstantSizedAtomicBitset final {
+
+        static_assert(SIZE > 0 && SIZE <= std::numeric_limits<Bitmask>::digits,
+                      "The ConstantSizedAtomicBitset SIZE must fit in its bitmask.");
+
+    public:
+
+        ConstantSizedAtomicBitset() :
+                bits(0) {
+        }
+
+        ~ConstantSizedAtomicBitset() noexcept = default;
+
+        /**
+         * @brief The ConstantSizedAtomicBitset are intended to be used as const instances. They shouldn't be moved.
+         */
+        ConstantSizedAtomicBitset(ConstantSizedAtomicBitset&& other) noexcept = delete;
+
+        /**
+         * @brief The ConstantSizedAtomicBitset are intended to be used as const instances. They shouldn't be copied.
+         */
+        ConstantSizedAtomicBitset(ConstantSizedAtomicBitset const& other) = delete;
+
+        /**
+         * @brief The ConstantSizedAtomicBitset are intended to be used as const instances. They shouldn't be assigned.
+         */
+        ConstantSizedAtomicBitset& operator=(ConstantSizedAtomicBitset const& other) = delete;
+
+        /**
+         * @brief The ConstantSizedAtomicBitset are intended to be used as const instances. They shouldn't be assigned.
+         */
+        ConstantSizedAtomicBitset& operator=(ConstantSizedAtomicBitset&& other) noexcept = delete;
+
+        /**
+         * @return true when the index was not already held.
+         */
+        bool insert(std::size_t index) noexcept {
+            auto const bit = Bitmask(1) << index;
+            return (bits.fetch_or(bit) & bit) == 0;
+        }
+
+        /**
+         * @return true when the index was held.
+         */
+        bool remove(std::size_t index) noexcept {
+            auto const bit = Bitmask(1) << index;
+            return (bits.fetch_and(~bit) & bit) != 0;
+        }
+
+        bool contains(std::size_t index) const noexcept {
+            return isBitSet(bits.load(), index);
+        }
+
+        bool isEmpty() const noexcept {
+            return bits.load() == 0;
+        }
+
+        /**
+         * @return the held index following or equal to the start index, wrapping around, or SIZE when empty.
+         */
+        std::size_t findFirstFrom(std::size_t start) const noexcept {
+            return findFirstSetBitFrom<SIZE>(bits.load(), start);
+        }
+
+        /**
+         * @return a snapshot of the held indexes, bit i being set when index i is held.
+         */
+        Bitmask snapshot() const noexcept {
+            return bits.load();
+        }
+
+    private:
+
+        std::atomic<Bitmask> bits;
+    };
+}
+
+#endif //SENSORGATEWAY_CONSTANTSIZEDATOMICBITSET_HPP
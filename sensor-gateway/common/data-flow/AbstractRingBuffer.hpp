@@ -0,0 +1,66 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_ABSTRACTRINGBUFFER_HPP
+#define SENSORGATEWAY_ABSTRACTRINGBUFFER_HPP
+
+#include "ConsumerLink.hpp"
+#include "DataBatch.hpp"
+#include "RingBufferMetrics.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief Consumer side of a RingBuffer, independent of its capacity, so that consumers can be linked to buffers of
+     * any size holding the same type of data.
+     */
+    template<class T>
+    class AbstractRingBuffer {
+
+    protected:
+
+        typedef ConsumerLink<T> Consumer;
+
+        AbstractRingBuffer() = default;
+
+    public:
+
+        virtual ~AbstractRingBuffer() = default;
+
+        virtual void write(T&& data) = 0;
+
+        virtual auto consumeNextDataFor(Consumer* consumer) -> T const& = 0;
+
+        virtual auto claimNextDataFor(Consumer* consumer) -> T& = 0;
+
+        virtual auto consumeUpTo(Consumer* consumer, size_t maximumNumberOfData) -> DataBatch<T> = 0;
+
+        virtual void releaseClaimedDataFor(Consumer* consumer) = 0;
+
+        virtual bool hasSingleConsumer() const noexcept = 0;
+
+        virtual void linkWith(Consumer* consumer) = 0;
+
+        virtual void unlink(Consumer* consumer) = 0;
+
+        virtual SequenceNumber fetchNumberOfLostDataFor(Consumer* consumer) = 0;
+
+        virtual ConsumerMetrics fetchMetricsFor(Consumer* consumer) = 0;
+    };
+}
+
+#endif //SENSORGATEWAY_ABSTRACTRINGBUFFER_HPP
@@ -0,0 +1,215 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_CONFLATINGRINGBUFFER_HPP
+#define SENSORGATEWAY_CONFLATINGRINGBUFFER_HPP
+
+#include "RingBuffer.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief Conflation key of the messages coming from several sensors, e.g.: SensorMessage.
+     */
+    struct SensorIdOf {
+        template<class MESSAGE>
+        SensorId operator()(MESSAGE const& message) const noexcept {
+            return message.sensorId;
+        }
+    };
+
+    /**
+     * @brief Single producer, multiple consumers ring buffer serving only the newest data of each key.
+     * The writer records the sequence of the newest data written for each key. A lagging consumer skips every data
+     * superseded by a newer data of the same key instead of replaying its backlog, so that its latency is bounded to one
+     * data per key. The skipped data are counted as lost by the consumer.
+     * @tparam KEY_OF functor giving the conflation key of a data, e.g.: SensorIdOf
+     * @note Only the first NUMBER_OF_KEYS keys are recorded, the data of the other keys are never skipped.
+     * @warning Concurrency Warning: Only one thread shall write to a ConflatingRingBuffer.
+     */
+    template<class T, class KEY_OF, size_t CAPACITY = RING_BUFFER_SIZE,
+            uint8_t NUMBER_OF_KEYS = MAXIMUM_NUMBER_OF_CONFLATED_KEYS>
+    class ConflatingRingBuffer final : public RingBuffer<T, CAPACITY> {
+        using super = RingBuffer<T, CAPACITY>;
+        using Consumer = typename super::Consumer;
+        using ConsumerCursor = typename super::ConsumerCursor;
+        using Key = typename std::decay<decltype(std::declval<KEY_OF>()(std::declval<T const&>()))>::type;
+
+        using super::NO_CLAIM;
+
+        /**
+         * @note The key is written once, before the key is published by the number of keys.
+         */
+        struct NewestSequenceOfKey {
+            Key key;
+            AtomicSequenceNumber sequence;
+        };
+
+    public:
+
+        explicit ConflatingRingBuffer(OverflowPolicy overflowPolicy = OverflowPolicy::DROP_OLDEST) :
+                super(overflowPolicy),
+                numberOfKeys(0) {
+            for (auto& newestSequenceOfKey : newestSequences) {
+                newestSequenceOfKey.sequence.store(0);
+            }
+        }
+
+        virtual ~ConflatingRingBuffer() = default;
+
+        ConflatingRingBuffer(ConflatingRingBuffer&& other) noexcept = delete;
+
+        ConflatingRingBuffer(ConflatingRingBuffer const& other) = delete;
+
+        ConflatingRingBuffer& operator=(ConflatingRingBuffer const& other) = delete;
+
+        ConflatingRingBuffer& operator=(ConflatingRingBuffer&& other) = delete;
+
+        void write(T&& data) override {
+            auto sequence = super::writerCursor.sequence.load(std::memory_order_relaxed);
+            if (!super::makeRoomFor(sequence)) {
+                return;
+            }
+            recordNewestSequenceOf(keyOf(data), sequence);
+            super::padAt(sequence).write(std::forward<T>(data));
+            super::stampWriteTimes(sequence, 1);
+            auto writtenSequence = sequence + 1;
+            super::writerCursor.sequence.store(writtenSequence, std::memory_order_release);
+            super::notifyConsumersIfAnyDataIsPresent(writtenSequence);
+        }
+
+        /**
+         * @brief Same as RingBuffer::writeBatch, recording the key of each data.
+         */
+        template<class ITERATOR>
+        void writeBatch(ITERATOR firstData, ITERATOR lastData) {
+            auto firstSequence = super::writerCursor.sequence.load(std::memory_order_relaxed);
+            auto sequence = firstSequence;
+            for (auto data = firstData; data != lastData; ++data) {
+                if (super::makeRoomFor(sequence)) {
+                    recordNewestSequenceOf(keyOf(*data), sequence);
+                    super::padAt(sequence).write(std::move(*data));
+                    ++sequence;
+                }
+            }
+            if (sequence != firstSequence) {
+                super::stampWriteTimes(firstSequence, sequence - firstSequence);
+                super::writerCursor.sequence.store(sequence, std::memory_order_release);
+                super::notifyConsumersIfAnyDataIsPresent(sequence);
+            }
+        }
+
+        /**
+         * @warning The returned data is not protected from the writer, it has to be copied right away.
+         */
+        auto consumeNextDataFor(Consumer* consumer) -> T const& override {
+            auto consumerCursor = super::fetchCursorOf(consumer);
+            auto sequence = claimNewestDataFor(consumerCursor);
+            super::throwErrorIfIllegalConsumption(sequence);
+            T const& currentData = super::padAt(sequence).read();
+            consumerCursor->claimedSequence.store(NO_CLAIM, std::memory_order_release);
+            super::advanceOrDeactivateConsumer(consumer, consumerCursor,
+                                               sequence + super::countAvailableDataFrom(sequence, 1));
+            return currentData;
+        }
+
+        auto claimNextDataFor(Consumer* consumer) -> T& override {
+            auto consumerCursor = super::fetchCursorOf(consumer);
+            auto sequence = claimNewestDataFor(consumerCursor);
+            super::throwErrorIfIllegalConsumption(sequence);
+            consumerCursor->numberOfClaimedData = super::countAvailableDataFrom(sequence, 1);
+            return super::padAt(sequence).read();
+        }
+
+        /**
+         * @brief Claims the available data of the consumer that are not superseded, up to the given maximum. The batch
+         * ends before the first superseded data, which is skipped by the next claim.
+         */
+        auto consumeUpTo(Consumer* consumer, size_t maximumNumberOfData) -> DataBatch<T> override {
+            auto consumerCursor = super::fetchCursorOf(consumer);
+            auto sequence = claimNewestDataFor(consumerCursor);
+            auto numberOfAvailableData = super::countAvailableDataFrom(sequence, maximumNumberOfData);
+            auto numberOfData = std::min<SequenceNumber>(numberOfAvailableData, 1);
+            while (numberOfData < numberOfAvailableData && !isSupersededAt(sequence + numberOfData)) {
+                ++numberOfData;
+            }
+            consumerCursor->numberOfClaimedData = numberOfData;
+            return super::batchOf(sequence, numberOfData);
+        }
+
+    private:
+
+        inline Key keyOf(T const& data) const noexcept {
+            return KEY_OF()(data);
+        }
+
+        void recordNewestSequenceOf(Key const& key, SequenceNumber sequence) {
+            auto numberOfRecordedKeys = numberOfKeys.load(std::memory_order_relaxed);
+            for (auto keyIndex = 0u; keyIndex < numberOfRecordedKeys; ++keyIndex) {
+                if (newestSequences[keyIndex].key == key) {
+                    newestSequences[keyIndex].sequence.store(sequence, std::memory_order_release);
+                    return;
+                }
+            }
+            if (numberOfRecordedKeys < NUMBER_OF_KEYS) {
+                newestSequences[numberOfRecordedKeys].key = key;
+                newestSequences[numberOfRecordedKeys].sequence.store(sequence, std::memory_order_relaxed);
+                numberOfKeys.store(numberOfRecordedKeys + 1, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @note The newest sequence of a key is recorded before its data is published, so a data can be superseded by
+         * one that is still being written.
+         */
+        bool isSupersededAt(SequenceNumber sequence) {
+            auto key = keyOf(super::padAt(sequence).read());
+            auto numberOfRecordedKeys = numberOfKeys.load(std::memory_order_acquire);
+            for (auto keyIndex = 0u; keyIndex < numberOfRecordedKeys; ++keyIndex) {
+                if (newestSequences[keyIndex].key == key) {
+                    return newestSequences[keyIndex].sequence.load(std::memory_order_acquire) > sequence;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Claims the next data of the consumer, then moves the claim over every superseded data and counts them
+         * as lost. The claim protects the skipped pads from the writer while their keys are read. The newest published
+         * data is never skipped, so that a consumer with available data always has one to read.
+         * @return the sequence to read for this consumer
+         */
+        SequenceNumber claimNewestDataFor(ConsumerCursor* consumerCursor) {
+            auto firstSequence = super::claimNextSequenceFor(consumerCursor);
+            auto writerSequence = super::readWriterSequence();
+            auto sequence = firstSequence;
+            while (sequence + 1 < writerSequence && isSupersededAt(sequence)) {
+                ++sequence;
+            }
+            if (sequence != firstSequence) {
+                consumerCursor->numberOfLostData.fetch_add(sequence - firstSequence, std::memory_order_relaxed);
+                consumerCursor->claimedSequence.store(sequence);
+            }
+            return sequence;
+        }
+
+        AtomicCounter numberOfKeys;
+
+        std::array<NewestSequenceOfKey, NUMBER_OF_KEYS> newestSequences;
+    };
+}
+
+#endif //SENSORGATEWAY_CONFLATINGRINGBUFFER_HPP
@@ -23,7 +23,7 @@
 namespace DataFlow {
 
     template<class T>
-    class RingBuffer;
+    class AbstractRingBuffer;
 
     template<class T>
     class ConsumerLink {
@@ -36,11 +36,19 @@ namespace DataFlow {
 
     public:
 
-        virtual void linkWith(RingBuffer<T>* buffer) = 0;
+        virtual void linkWith(AbstractRingBuffer<T>* buffer) = 0;
 
-        virtual void activateFor(RingBuffer<T>* buffer) = 0;
+        virtual void activateFor(AbstractRingBuffer<T>* buffer) = 0;
 
-        virtual void deactivateFor(RingBuffer<T>* buffer) = 0;
+        virtual void deactivateFor(AbstractRingBuffer<T>* buffer) = 0;
+
+        /**
+         * @brief Back pressure: tells the buffer, and through it the producer, that the stages fed by this consumer are
+         * falling behind.
+         */
+        virtual bool isFallingBehind() const noexcept {
+            return false;
+        }
     };
 }
 
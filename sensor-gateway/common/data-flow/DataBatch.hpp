@@ -0,0 +1,94 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_DATABATCH_HPP
+#define SENSORGATEWAY_DATABATCH_HPP
+
+#include "RingBufferPad.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief View over consecutive pads of a RingBuffer. Since the pads wrap around at the end of the buffer, the batch
+     * is made of up to two contiguous segments.
+     * @warning The batch does not own its data, it is only valid until it is released to the RingBuffer it comes from.
+     */
+    template<class T>
+    class DataBatch {
+
+        typedef RingBufferPad<T> Pad;
+
+    public:
+
+        DataBatch(Pad* firstSegment, size_t firstSegmentSize, Pad* secondSegment, size_t secondSegmentSize) noexcept :
+                firstSegment(firstSegment),
+                firstSegmentSize(firstSegmentSize),
+                secondSegment(secondSegment),
+                secondSegmentSize(secondSegmentSize) {
+        }
+
+        ~DataBatch() noexcept = default;
+
+        DataBatch(DataBatch const& other) = default;
+
+        DataBatch(DataBatch&& other) noexcept = default;
+
+        /**
+         * @warning The DataBatches are views on a RingBuffer. They shouldn't be assigned.
+         */
+        DataBatch& operator=(DataBatch const& other) = delete;
+
+        /**
+         * @warning The DataBatches are views on a RingBuffer. They shouldn't be assigned.
+         */
+        DataBatch& operator=(DataBatch&& other) = delete;
+
+        size_t size() const noexcept {
+            return firstSegmentSize + secondSegmentSize;
+        }
+
+        bool isEmpty() const noexcept {
+            return size() == 0;
+        }
+
+        auto operator[](size_t index) noexcept -> T& {
+            if (index < firstSegmentSize) {
+                return firstSegment[index].read();
+            }
+            return secondSegment[index - firstSegmentSize].read();
+        }
+
+        template<class FUNCTION>
+        void forEach(FUNCTION&& function) {
+            for (auto index = 0u; index < firstSegmentSize; ++index) {
+                function(firstSegment[index].read());
+            }
+            for (auto index = 0u; index < secondSegmentSize; ++index) {
+                function(secondSegment[index].read());
+            }
+        }
+
+    private:
+
+        Pad* const firstSegment;
+        size_t const firstSegmentSize;
+        Pad* const secondSegment;
+        size_t const secondSegmentSize;
+    };
+}
+
+#endif //SENSORGATEWAY_DATABATCH_HPP
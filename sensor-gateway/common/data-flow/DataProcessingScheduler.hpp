@@ -18,24 +18,48 @@
 #define SENSORGATEWAY_DATAPROCESSINGSCHEDULER_HPP
 
 #include "DataSink.hpp"
+#include "InputSelectionPolicies.hpp"
+#include "WaitStrategies.hpp"
+#include "WorkStealingExecutor.hpp"
 
 namespace DataFlow {
 
-    template<class T, class SINK, size_t const NUMBER_OF_CONCURRENT_INPUTS>
-    class DataProcessingScheduler : public ConsumerLink<T> {
-
-        typedef RingBuffer<T> InputBuffer;
-        typedef Container::ConstantSizedPointerList<InputBuffer, NUMBER_OF_CONCURRENT_INPUTS> InputBuffers;
+    /**
+     * @brief Feeds its sink with the data of its input buffers, either from its own thread or, when given an executor,
+     * as a task scheduled on that executor every time one of its input buffers is activated.
+     * @tparam WAIT_STRATEGY how the scheduler's own thread waits for its input buffers, see WaitStrategies.hpp
+     * @tparam INPUT_SELECTION_POLICY which ready input buffer the next batch is consumed from, using the weights given
+     * to the inputs in the order they are linked, see InputSelectionPolicies.hpp
+     */
+    template<class T, class SINK, size_t const NUMBER_OF_CONCURRENT_INPUTS,
+            class WAIT_STRATEGY = BusySpinWaitStrategy,
+            class INPUT_SELECTION_POLICY = RoundRobinInputSelectionPolicy<NUMBER_OF_CONCURRENT_INPUTS>>
+    class DataProcessingScheduler : public ConsumerLink<T>, public ExecutorTask {
+
+        typedef AbstractRingBuffer<T> InputBuffer;
+        typedef Container::ConstantSizedAtomicBitset<NUMBER_OF_CONCURRENT_INPUTS> InputBufferSet;
+        typedef InputWeights<NUMBER_OF_CONCURRENT_INPUTS> Weights;
 
     public:
 
-        DataProcessingScheduler(SINK* dataSink) :
+        explicit DataProcessingScheduler(SINK* dataSink, WorkStealingExecutor* executor = nullptr) :
+                DataProcessingScheduler(dataSink, uniformWeights(), executor) {
+        }
+
+        DataProcessingScheduler(SINK* dataSink, Weights const& inputWeights, WorkStealingExecutor* executor = nullptr) :
                 terminateOrderReceived(false),
+                scheduledOnExecutor(false),
+                numberOfExecutionsInProgress(0),
                 numberOfLinkedBuffers(0),
                 dataSink(dataSink),
+                executor(executor),
+                inputWeights(inputWeights),
                 schedulerThread(JoinableThread(doNothing)) {
+            linkedInputBuffers.fill(nullptr);
             schedulerThread.exitSafely();
-            schedulerThread = JoinableThread(&DataProcessingScheduler::start, this);
+            if (!isExecutedByAnExecutor()) {
+                schedulerThread = JoinableThread(&DataProcessingScheduler::start, this);
+            }
         }
 
         ~DataProcessingScheduler() noexcept = default;
@@ -61,54 +85,173 @@ namespace DataFlow {
         DataProcessingScheduler& operator=(DataProcessingScheduler&& other) = delete;
 
         void linkWith(InputBuffer* inputBuffer) override {
-            LockGuard guard(inputBufferStatusMutex);
+            LockGuard guard(linkingMutex);
             throwExceptionIfInputBufferIsLinked(inputBuffer);
             throwExceptionIfSchedulerHasReceivedTerminationOrder();
             throwExceptionIfMaximumOfLinkedBufferReached();
+            linkedInputBuffers[numberOfLinkedBuffers.load()] = inputBuffer;
             ++numberOfLinkedBuffers;
-            notReadyToConsumeInputBuffers.store(inputBuffer);
             inputBuffer->linkWith(this);
         }
 
+        /**
+         * @note Activation and deactivation are lock free : the buffer's link position is looked up among the few
+         * linked buffers, then its ready bit is flipped with a single atomic operation.
+         */
         void activateFor(InputBuffer* inputBuffer) override {
-            LockGuard guard(inputBufferStatusMutex);
-            throwExceptionIfInputBufferIsNotLinked(inputBuffer,
-                                                   ExceptionMessage::DATA_PROCESSING_SCHEDULER_ILLEGAL_ACTIVATION_MESSAGE);
-            if (notReadyToConsumeInputBuffers.contains(inputBuffer)) {
-                notReadyToConsumeInputBuffers.remove(inputBuffer);
-                readyToConsumeInputBuffers.store(inputBuffer);
+            auto input = fetchLinkPositionOf(inputBuffer,
+                                             ExceptionMessage::DATA_PROCESSING_SCHEDULER_ILLEGAL_ACTIVATION_MESSAGE);
+            if (readyToConsumeInputBuffers.insert(input)) {
+                waitStrategy.signal();
+                scheduleOnExecutor();
             }
         }
 
         void deactivateFor(InputBuffer* inputBuffer) override {
-            LockGuard guard(inputBufferStatusMutex);
-            throwExceptionIfInputBufferIsNotLinked(inputBuffer,
-                                                   ExceptionMessage::DATA_PROCESSING_SCHEDULER_ILLEGAL_DEACTIVATION_MESSAGE);
-            if (readyToConsumeInputBuffers.contains(inputBuffer)) {
-                readyToConsumeInputBuffers.remove(inputBuffer);
-                notReadyToConsumeInputBuffers.store(inputBuffer);
+            auto input = fetchLinkPositionOf(inputBuffer,
+                                             ExceptionMessage::DATA_PROCESSING_SCHEDULER_ILLEGAL_DEACTIVATION_MESSAGE);
+            readyToConsumeInputBuffers.remove(input);
+        }
+
+        /**
+         * @note The scheduler falls behind when its sink does, its own lag is measured by its input buffers.
+         */
+        bool isFallingBehind() const noexcept override {
+            return static_cast<DataSink<T> const*>(dataSink)->isFallingBehind();
+        }
+
+        /**
+         * @brief Detaches the scheduler from its input buffers, so that they neither wait for it nor notify it anymore,
+         * e.g.: to remove a diagnostic tap from a running gateway.
+         * The input slots are emptied under the linking mutex, which metrics queries also hold, so that a query
+         * reaches either every input buffer or none of them.
+         * @warning The scheduler shall be terminated beforehand, see terminateAndJoin.
+         */
+        void unlinkFromInputs() {
+            LockGuard guard(linkingMutex);
+            auto const numberOfInputs = numberOfLinkedBuffers.load();
+            for (auto input = 0u; input < numberOfInputs; ++input) {
+                linkedInputBuffers[input]->unlink(this);
+                linkedInputBuffers[input] = nullptr;
+                readyToConsumeInputBuffers.remove(input);
             }
+            numberOfLinkedBuffers.store(0);
+        }
+
+        /**
+         * @brief Snapshot of the lag of the scheduler on each of its input buffers, in link order.
+         */
+        SchedulerMetrics<NUMBER_OF_CONCURRENT_INPUTS> fetchMetrics() {
+            LockGuard guard(linkingMutex);
+            SchedulerMetrics<NUMBER_OF_CONCURRENT_INPUTS> metrics{};
+            metrics.numberOfInputs = numberOfLinkedBuffers.load();
+            for (auto input = 0u; input < metrics.numberOfInputs; ++input) {
+                metrics.inputs[input] = linkedInputBuffers[input]->fetchMetricsFor(this);
+            }
+            return metrics;
         }
 
         void terminateAndJoin() {
             if (!terminateOrderHasBeenReceived()) {
                 terminateOrderReceived.store(true);
             }
+            waitStrategy.signal();
+            waitUntilIdleOnExecutor();
             schedulerThread.exitSafely();
         }
 
+        /**
+         * @brief Consumes up to one batch per linked input buffer, then gives the worker back to the executor. The
+         * scheduler is scheduled again if input buffers are still ready.
+         * @note Once scheduled again, the scheduler can be executed by another worker before this execution returns.
+         * The executions in progress are therefore counted, and the count is the last member this execution touches,
+         * so that terminateAndJoin does not return while a worker still uses the scheduler.
+         */
+        void execute() override {
+            ++numberOfExecutionsInProgress;
+            auto numberOfConsumedBatches = 0u;
+            while (!readyToConsumeInputBuffers.isEmpty() && numberOfConsumedBatches < NUMBER_OF_CONCURRENT_INPUTS) {
+                consumeNextBatch();
+                ++numberOfConsumedBatches;
+            }
+            scheduledOnExecutor.store(false);
+            if (!readyToConsumeInputBuffers.isEmpty()) {
+                scheduleOnExecutor();
+            }
+            --numberOfExecutionsInProgress;
+        }
+
     private:
 
+        /**
+         * @note The sink handles the idle inputs every time the wait strategy checks them, i.e.: continuously with the
+         * spinning strategies, only when signaled with the BlockingWaitStrategy.
+         */
         void start() {
             while (cannotExitSafely()) {
+                waitStrategy.waitUntil([this]() {
+                    if (readyToConsumeInputBuffers.isEmpty() && !terminateOrderHasBeenReceived()) {
+                        static_cast<DataSink<T>*>(dataSink)->handleIdleInputs();
+                        return false;
+                    }
+                    return true;
+                });
                 if (!readyToConsumeInputBuffers.isEmpty()) {
-                    auto inputBufferToConsumeFrom = readyToConsumeInputBuffers.readNextPointerToConsume();
-                    auto data = inputBufferToConsumeFrom->consumeNextDataFor(this);
-                    dataSink->consume(std::move(data));
+                    consumeNextBatch();
                 }
             }
         }
 
+        void consumeNextBatch() {
+            auto input = inputSelectionPolicy.selectNextInput(readyToConsumeInputBuffers.snapshot(), inputWeights);
+            auto numberOfConsumedData = consumeNextDataFrom(linkedInputBuffers[input]);
+            inputSelectionPolicy.accountFor(input, numberOfConsumedData);
+        }
+
+        /**
+         * @note The available data are claimed as a batch and processed in place. They are only copied when other
+         * consumers will read the same pads, since the sink is allowed to move from them. Both calls are resolved
+         * through SINK, so that a final sink consumes the batch without a virtual call per datum. The sinks consuming
+         * several data types shall therefore declare a consumeBatch for each of them.
+         */
+        size_t consumeNextDataFrom(InputBuffer* inputBuffer) {
+            auto claimedData = inputBuffer->consumeUpTo(this, MAXIMUM_NUMBER_OF_DATA_PER_BATCH);
+            auto numberOfClaimedData = claimedData.size();
+            if (inputBuffer->hasSingleConsumer()) {
+                dataSink->consumeBatch(claimedData);
+            } else {
+                claimedData.forEach([this](T const& claimedDatum) {
+                    auto data = claimedDatum;
+                    dataSink->consume(std::move(data));
+                });
+            }
+            inputBuffer->releaseClaimedDataFor(this);
+            return numberOfClaimedData;
+        }
+
+        static Weights uniformWeights() noexcept {
+            Weights weights;
+            weights.fill(1);
+            return weights;
+        }
+
+        bool isExecutedByAnExecutor() const noexcept {
+            return executor != nullptr;
+        }
+
+        void scheduleOnExecutor() {
+            if (isExecutedByAnExecutor() && !scheduledOnExecutor.exchange(true)) {
+                executor->schedule(this);
+            }
+        }
+
+        void waitUntilIdleOnExecutor() const {
+            while (isExecutedByAnExecutor() && (scheduledOnExecutor.load() || numberOfExecutionsInProgress.load() != 0
+                                                || !readyToConsumeInputBuffers.isEmpty())) {
+                std::this_thread::yield();
+            }
+        }
+
         bool cannotExitSafely() const noexcept {
             return !(readyToConsumeInputBuffers.isEmpty() && terminateOrderHasBeenReceived());
         }
@@ -124,11 +267,26 @@ namespace DataFlow {
             }
         }
 
+        InputIndex findLinkPositionOf(InputBuffer* inputBuffer) const noexcept {
+            InputIndex input = 0;
+            auto const numberOfInputs = numberOfLinkedBuffers.load();
+            while (input < numberOfInputs && linkedInputBuffers[input] != inputBuffer) {
+                ++input;
+            }
+            return input;
+        }
+
         bool isInputBufferLinked(InputBuffer* inputBuffer) const noexcept {
-            return notReadyToConsumeInputBuffers.contains(inputBuffer) ||
-                   readyToConsumeInputBuffers.contains(inputBuffer);
+            return findLinkPositionOf(inputBuffer) < numberOfLinkedBuffers.load();
         }
 
+        InputIndex fetchLinkPositionOf(InputBuffer* inputBuffer, char const* messageIfNotLinked) const {
+            auto input = findLinkPositionOf(inputBuffer);
+            if (input >= numberOfLinkedBuffers.load()) {
+                throwRuntimeError(messageIfNotLinked);
+            }
+            return input;
+        }
 
         void throwExceptionIfInputBufferIsLinked(InputBuffer* inputBuffer) const {
             if (isInputBufferLinked(inputBuffer)) {
@@ -144,20 +302,20 @@ namespace DataFlow {
             }
         }
 
-        void throwExceptionIfInputBufferIsNotLinked(InputBuffer* inputBuffer, char const* message) const {
-            if (!isInputBufferLinked(inputBuffer)) {
-                throwRuntimeError(message);
-            }
-        }
-
         JoinableThread schedulerThread;
 
         AtomicFlag terminateOrderReceived;
-        Mutex inputBufferStatusMutex;
+        AtomicFlag scheduledOnExecutor;
+        AtomicCounter numberOfExecutionsInProgress;
+        Mutex linkingMutex;
         AtomicCounter numberOfLinkedBuffers;
-        InputBuffers readyToConsumeInputBuffers;
-        InputBuffers notReadyToConsumeInputBuffers;
+        InputBufferSet readyToConsumeInputBuffers;
         SINK* dataSink;
+        WorkStealingExecutor* executor;
+        WAIT_STRATEGY waitStrategy;
+        std::array<InputBuffer*, NUMBER_OF_CONCURRENT_INPUTS> linkedInputBuffers;
+        Weights const inputWeights;
+        INPUT_SELECTION_POLICY inputSelectionPolicy;
     };
 }
 
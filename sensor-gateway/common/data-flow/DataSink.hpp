@@ -31,6 +31,29 @@ namespace DataFlow {
         virtual ~DataSink() noexcept = default;
 
         virtual void consume(DATA&& data) = 0;
+
+        /**
+         * @brief Consumes every data of the batch. Sinks can override it to amortise their per data overhead.
+         */
+        virtual void consumeBatch(DataBatch<DATA>& batch) {
+            batch.forEach([this](DATA& data) {
+                consume(std::move(data));
+            });
+        }
+
+        /**
+         * @brief Called by a scheduler running on its own thread while its input buffers are empty, so that the sinks
+         * holding data until a deadline can release them even though no new data arrive.
+         */
+        virtual void handleIdleInputs() {}
+
+        /**
+         * @brief Sinks that produce data themselves report here whether their own output is congested, so that the
+         * congestion travels back up the whole pipeline.
+         */
+        virtual bool isFallingBehind() const noexcept {
+            return false;
+        }
     };
 }
 
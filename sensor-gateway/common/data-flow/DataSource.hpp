@@ -18,28 +18,77 @@
 #define SENSORGATEWAY_DATASOURCE_HPP
 
 #include "ThreadSafeRingBuffer.hpp"
+#include "ConflatingRingBuffer.hpp"
 
 namespace DataFlow {
 
-    template<class T>
+    /**
+     * @tparam OUTPUT_BUFFER a RingBuffer when the data are produced by a single thread, a ThreadSafeRingBuffer otherwise,
+     * a ConflatingRingBuffer when the consumers only need the newest data of each key
+     */
+    template<class T, size_t CAPACITY = RING_BUFFER_SIZE, class OUTPUT_BUFFER = RingBuffer<T, CAPACITY>>
     class DataSource {
 
     public:
 
+        explicit DataSource(OverflowPolicy overflowPolicy = OverflowPolicy::DROP_OLDEST) :
+                outputBuffer(overflowPolicy) {
+        }
+
         virtual ~DataSource() noexcept = default;
 
         void linkConsumer(ConsumerLink<T>* consumer) {
             consumer->linkWith(&outputBuffer);
         }
 
+        /**
+         * @warning The consumer shall have stopped consuming, e.g.: its scheduler is terminated.
+         */
+        void unlinkConsumer(ConsumerLink<T>* consumer) {
+            outputBuffer.unlink(consumer);
+        }
+
         virtual void produce(T&& data) {
             outputBuffer.write(std::forward<T>(data));
         }
 
+        /**
+         * @brief Produces every data of the range at once, moving from them.
+         */
+        template<class ITERATOR>
+        void produceBatch(ITERATOR firstData, ITERATOR lastData) {
+            outputBuffer.writeBatch(firstData, lastData);
+        }
+
+        /**
+         * @brief Back pressure: true when the output buffer is filling up or when a stage downstream is falling behind.
+         */
+        bool isOutputCongested() const noexcept {
+            return outputBuffer.isCongested();
+        }
+
+        SequenceNumber fetchNumberOfLostDataFor(ConsumerLink<T>* consumer) {
+            return outputBuffer.fetchNumberOfLostDataFor(consumer);
+        }
+
+        RingBufferMetrics fetchOutputMetrics() const noexcept {
+            return outputBuffer.fetchMetrics();
+        }
+
     protected:
-        DataFlow::RingBuffer<T> outputBuffer;
+        OUTPUT_BUFFER outputBuffer;
 
     };
+
+    template<class T, size_t CAPACITY = RING_BUFFER_SIZE>
+    using MultiProducerDataSource = DataSource<T, CAPACITY, ThreadSafeRingBuffer<T, CAPACITY>>;
+
+    /**
+     * @brief Serves its lagging consumers the newest data of each key only, e.g.: a dashboard or a low bandwidth uplink
+     * that only needs the newest SensorMessage of each sensor. The skipped data are counted as lost.
+     */
+    template<class T, class KEY_OF = SensorIdOf, size_t CAPACITY = RING_BUFFER_SIZE>
+    using ConflatingDataSource = DataSource<T, CAPACITY, ConflatingRingBuffer<T, KEY_OF, CAPACITY>>;
 }
 
 #endif //SENSORGATEWAY_DATASOURCE_HPP
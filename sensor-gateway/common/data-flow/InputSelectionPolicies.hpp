@@ -0,0 +1,141 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_INPUTSELECTIONPOLICIES_HPP
+#define SENSORGATEWAY_INPUTSELECTIONPOLICIES_HPP
+
+#include "sensor-gateway/common/ConstantValuesDefinition.h"
+#include "sensor-gateway/common/container/ConstantSizedAtomicBitset.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief The weight of an input of a DataProcessingScheduler, given in the order the inputs are linked. Its meaning
+     * depends on the input selection policy : a number of batches, a priority or a share of the consumed data.
+     */
+    using InputWeight = uint8_t;
+    using InputIndex = uint8_t;
+
+    template<size_t NUMBER_OF_INPUTS>
+    using InputWeights = std::array<InputWeight, NUMBER_OF_INPUTS>;
+
+    /**
+     * @brief Bit i is set when the input linked in position i is ready to be consumed.
+     */
+    using ReadyInputs = Container::Bitmask;
+
+    /**
+     * @brief The input selection policies decide which ready input a DataProcessingScheduler consumes its next batch
+     * from. selectNextInput is only called with at least one input ready, accountFor is called once the batch of the
+     * selected input has been consumed. Both are only called from the thread consuming the inputs.
+     */
+
+    /**
+     * @brief Consumes up to weight batches from an input before moving to the next ready one.
+     */
+    template<size_t NUMBER_OF_INPUTS>
+    class RoundRobinInputSelectionPolicy {
+
+    public:
+
+        RoundRobinInputSelectionPolicy() :
+                currentInput(0),
+                numberOfBatchesLeft(0) {
+        }
+
+        InputIndex selectNextInput(ReadyInputs readyInputs, InputWeights<NUMBER_OF_INPUTS> const& weights) {
+            if (numberOfBatchesLeft == 0 || !Container::isBitSet(readyInputs, currentInput)) {
+                auto nextInput = (currentInput + 1u) % NUMBER_OF_INPUTS;
+                currentInput = Container::findFirstSetBitFrom<NUMBER_OF_INPUTS>(readyInputs, nextInput);
+                numberOfBatchesLeft = std::max<InputWeight>(weights[currentInput], 1);
+            }
+            return currentInput;
+        }
+
+        void accountFor(InputIndex, size_t) noexcept {
+            --numberOfBatchesLeft;
+        }
+
+    private:
+
+        InputIndex currentInput;
+        InputWeight numberOfBatchesLeft;
+    };
+
+    /**
+     * @brief Always consumes from the ready input with the highest weight, the first linked one on ties. Inputs with a
+     * lower weight are only consumed when every input above them is empty.
+     */
+    template<size_t NUMBER_OF_INPUTS>
+    class StrictPriorityInputSelectionPolicy {
+
+    public:
+
+        InputIndex selectNextInput(ReadyInputs readyInputs, InputWeights<NUMBER_OF_INPUTS> const& weights) const {
+            auto selectedInput = Container::findFirstSetBitFrom<NUMBER_OF_INPUTS>(readyInputs, 0);
+            for (auto input = selectedInput + 1; input < NUMBER_OF_INPUTS; ++input) {
+                if (Container::isBitSet(readyInputs, input) && weights[input] > weights[selectedInput]) {
+                    selectedInput = input;
+                }
+            }
+            return static_cast<InputIndex>(selectedInput);
+        }
+
+        void accountFor(InputIndex, size_t) const noexcept {}
+    };
+
+    /**
+     * @brief Deficit round robin : every turn credits an input with weight full batches worth of data, and the input
+     * is consumed until the data it consumed exceed its credit. Over time, each busy input gets a share of the consumed
+     * data proportional to its weight, whatever the size of its batches. An input that runs empty loses its credit.
+     */
+    template<size_t NUMBER_OF_INPUTS>
+    class DeficitWeightedInputSelectionPolicy {
+
+        using Deficit = int32_t;
+
+    public:
+
+        DeficitWeightedInputSelectionPolicy() :
+                currentInput(0) {
+            deficits.fill(0);
+        }
+
+        InputIndex selectNextInput(ReadyInputs readyInputs, InputWeights<NUMBER_OF_INPUTS> const& weights) {
+            if (!Container::isBitSet(readyInputs, currentInput)) {
+                deficits[currentInput] = 0;
+            }
+            while (!Container::isBitSet(readyInputs, currentInput) || deficits[currentInput] <= 0) {
+                auto nextInput = (currentInput + 1u) % NUMBER_OF_INPUTS;
+                currentInput = Container::findFirstSetBitFrom<NUMBER_OF_INPUTS>(readyInputs, nextInput);
+                deficits[currentInput] += std::max<InputWeight>(weights[currentInput], 1) *
+                                          static_cast<Deficit>(MAXIMUM_NUMBER_OF_DATA_PER_BATCH);
+            }
+            return currentInput;
+        }
+
+        void accountFor(InputIndex input, size_t numberOfConsumedData) noexcept {
+            deficits[input] -= static_cast<Deficit>(numberOfConsumedData);
+        }
+
+    private:
+
+        InputIndex currentInput;
+        std::array<Deficit, NUMBER_OF_INPUTS> deficits;
+    };
+}
+
+#endif //SENSORGATEWAY_INPUTSELECTIONPOLICIES_HPP
@@ -18,30 +18,114 @@
 #ifndef SENSORGATEWAY_RINGBUFFER_H
 #define SENSORGATEWAY_RINGBUFFER_H
 
-#include <unordered_map>
-#include "ConsumerLink.hpp"
-#include "RingBufferPad.hpp"
+#include "AbstractRingBuffer.hpp"
 
 using DataFlow::RING_BUFFER_SIZE;
 
 namespace DataFlow {
 
-    template<class T>
-    class RingBuffer {
+    /**
+     * @brief Decides what a RingBuffer does when writing would overwrite data that a linked consumer has not read yet.
+     * DROP_OLDEST: the data is overwritten, the lapped consumer skips to the oldest data still held.
+     * DROP_NEWEST: the data to write is discarded.
+     * BLOCK_PRODUCER: the writer waits until the slowest consumer frees a pad.
+     */
+    enum OverflowPolicy : int32_t {
+        DROP_OLDEST,
+        DROP_NEWEST,
+        BLOCK_PRODUCER,
+    };
+
+    /**
+     * @brief Single producer, multiple consumers ring buffer.
+     * The writer publishes a monotonically increasing sequence number and every linked consumer owns a cursor holding
+     * the next sequence it will read. A sequence is mapped to its pad with a mask, so the capacity MUST be a power of two.
+     * The data lost by each consumer because of the OverflowPolicy is counted and can be fetched at any time.
+     * A consumer can claim its next data, or a batch of them, to process them in place. The writer never overwrites a
+     * claimed pad, it waits for the consumer to release it.
+     * @warning Concurrency Warning: Only one thread shall write to a RingBuffer, see ThreadSafeRingBuffer otherwise. Each
+     * consumer shall only be served by one thread at a time.
+     */
+    template<class T, size_t CAPACITY = RING_BUFFER_SIZE>
+    class RingBuffer : public AbstractRingBuffer<T> {
+
+        static_assert(CAPACITY != 0 && (CAPACITY & (CAPACITY - 1)) == 0, "The RingBuffer CAPACITY must be a power of two");
 
     protected:
 
         typedef ConsumerLink<T> Consumer;
 
-        typedef std::unordered_map<Consumer*, RingBufferPad<T>*> ConsumerLocationsMap;
+        static uint8_t const NUMBER_OF_CONSUMER_PER_BUFFER = MAXIMUM_NUMBER_OF_CONSUMERS_PER_RING_BUFFER;
+
+        static SequenceNumber const INDEX_MASK = CAPACITY - 1;
+
+        static SequenceNumber const NO_CLAIM = std::numeric_limits<SequenceNumber>::max();
+
+        static SequenceNumber const HIGH_WATERMARK = CAPACITY * HIGH_WATERMARK_PERCENTAGE / 100;
+
+        static SequenceNumber const LOW_WATERMARK = CAPACITY * LOW_WATERMARK_PERCENTAGE / 100;
 
-        uint8_t const NUMBER_OF_CONSUMER_PER_BUFFER = 8;
+        /**
+         * @brief Published and reserved sequences of the writer, alone on their cache line so that the writer and the
+         * consumers advancing concurrently do not invalidate each other's cache.
+         */
+        struct WriterCursor {
+            AtomicSequenceNumber sequence;
+            AtomicSequenceNumber reservedSequence;
+            Byte padding[CACHE_LINE_SIZE - 2 * sizeof(AtomicSequenceNumber)];
+        };
+
+        /**
+         * @brief A consumer cursor is only read by the writer once LINKED. While UNLINKING, the writer no longer waits
+         * for the consumer nor notifies it, but the cursor cannot be reused until the notifications in progress end.
+         */
+        enum LinkState : uint8_t {
+            UNLINKED,
+            LINKING,
+            LINKED,
+            UNLINKING,
+        };
+
+        /**
+         * @brief Read position of a consumer, the data it claimed and the number of data it lost, sharing the
+         * consumer's cache line.
+         * @note The number of claimed data is only accessed by the consumer.
+         */
+        struct ConsumerCursor {
+            AtomicSequenceNumber sequence;
+            AtomicSequenceNumber claimedSequence;
+            AtomicSequenceNumber numberOfLostData;
+            SequenceNumber numberOfClaimedData;
+            std::atomic<uint8_t> linkState;
+            Byte padding[CACHE_LINE_SIZE - 3 * sizeof(AtomicSequenceNumber) - sizeof(SequenceNumber)
+                         - sizeof(std::atomic<uint8_t>)];
+        };
 
     public:
 
-        RingBuffer() : writerLocation(&buffer[0]) {
-            consumerLocationsMap.reserve(NUMBER_OF_CONSUMER_PER_BUFFER);
-            chainPadsInBuffer();
+        explicit RingBuffer(OverflowPolicy overflowPolicy = OverflowPolicy::DROP_OLDEST) :
+                overflowPolicy(overflowPolicy),
+                aboveHighWatermark(false),
+                slowestConsumerSequence(0),
+                highestOccupancy(0),
+                numberOfLinkedConsumers(0),
+                numberOfConsumerSlotsInUse(0),
+                numberOfNotificationsInProgress(0) {
+            writerCursor.sequence.store(0);
+            writerCursor.reservedSequence.store(0);
+            for (auto& linkedConsumer : linkedConsumers) {
+                linkedConsumer.store(nullptr);
+            }
+            for (auto& consumerCursor : consumerCursors) {
+                consumerCursor.sequence.store(0);
+                consumerCursor.claimedSequence.store(NO_CLAIM);
+                consumerCursor.numberOfClaimedData = 0;
+                consumerCursor.numberOfLostData.store(0);
+                consumerCursor.linkState.store(LinkState::UNLINKED);
+            }
+            for (auto& writeTime : writeTimes) {
+                writeTime.store(0);
+            }
         }
 
         virtual ~RingBuffer() = default;
@@ -49,7 +133,7 @@ namespace DataFlow {
         /**
          *@warning The RingBuffers are intended to be used as const instances. They shouldn't be moved.
          */
-        RingBuffer(RingBuffer&& other) noexcept = default;
+        RingBuffer(RingBuffer&& other) noexcept = delete;
 
         /**
          * @warning The RingBuffers are intended to be used as const instances. They shouldn't be assigned.
@@ -67,97 +151,562 @@ namespace DataFlow {
         RingBuffer& operator=(RingBuffer&& other) = delete;
 
 
-        virtual void write(T&& data) {
-            writerLocation->write(std::forward<T>(data));
-            writerLocation = writerLocation->next();
-            notifyConsumersIfAnyDataIsPresent();
+        void write(T&& data) override {
+            auto sequence = writerCursor.sequence.load(std::memory_order_relaxed);
+            if (!makeRoomFor(sequence)) {
+                return;
+            }
+            padAt(sequence).write(std::forward<T>(data));
+            stampWriteTimes(sequence, 1);
+            auto writtenSequence = sequence + 1;
+            writerCursor.sequence.store(writtenSequence, std::memory_order_release);
+            notifyConsumersIfAnyDataIsPresent(writtenSequence);
         }
 
 
-        virtual auto consumeNextDataFor(Consumer* consumer) -> T const& {
-            addLinkIfNoneExists(consumer);
-            throwErrorIfIllegalConsumption(consumer);
-            T const& currentData = consumeFor(consumer);
-            advanceOrDeactivateConsumer(consumer);
+        /**
+         * @brief Writes every data of the range, moving from them, then publishes them all with a single store and
+         * notifies the consumers once.
+         */
+        template<class ITERATOR>
+        void writeBatch(ITERATOR firstData, ITERATOR lastData) {
+            auto firstSequence = writerCursor.sequence.load(std::memory_order_relaxed);
+            auto sequence = firstSequence;
+            for (auto data = firstData; data != lastData; ++data) {
+                if (makeRoomFor(sequence)) {
+                    padAt(sequence).write(std::move(*data));
+                    ++sequence;
+                }
+            }
+            if (sequence != firstSequence) {
+                stampWriteTimes(firstSequence, sequence - firstSequence);
+                writerCursor.sequence.store(sequence, std::memory_order_release);
+                notifyConsumersIfAnyDataIsPresent(sequence);
+            }
+        }
+
+        /**
+         * @warning The returned data is not protected from the writer, it has to be copied right away.
+         */
+        auto consumeNextDataFor(Consumer* consumer) -> T const& override {
+            auto consumerCursor = fetchCursorOf(consumer);
+            auto sequence = skipOverwrittenData(consumerCursor);
+            throwErrorIfIllegalConsumption(sequence);
+            T const& currentData = padAt(sequence).read();
+            advanceOrDeactivateConsumer(consumer, consumerCursor, sequence + countAvailableDataFrom(sequence, 1));
             return currentData;
         }
 
-        virtual void linkWith(Consumer* consumer) noexcept {
-            addLinkIfNoneExists(consumer);
+        /**
+         * @brief Gives access to the next data of the consumer without copying it. The pad stays claimed, so it can be
+         * processed in place, until releaseClaimedDataFor is called for the same consumer.
+         */
+        auto claimNextDataFor(Consumer* consumer) -> T& override {
+            auto consumerCursor = fetchCursorOf(consumer);
+            auto sequence = claimNextSequenceFor(consumerCursor);
+            throwErrorIfIllegalConsumption(sequence);
+            consumerCursor->numberOfClaimedData = countAvailableDataFrom(sequence, 1);
+            return padAt(sequence).read();
+        }
+
+        /**
+         * @brief Claims the available data of the consumer, up to the given maximum, so that they can be processed in
+         * place as a batch. The batch is released with releaseClaimedDataFor.
+         */
+        auto consumeUpTo(Consumer* consumer, size_t maximumNumberOfData) -> DataBatch<T> override {
+            auto consumerCursor = fetchCursorOf(consumer);
+            auto sequence = claimNextSequenceFor(consumerCursor);
+            auto numberOfData = countAvailableDataFrom(sequence, maximumNumberOfData);
+            consumerCursor->numberOfClaimedData = numberOfData;
+            return batchOf(sequence, numberOfData);
         }
 
-    private:
+        void releaseClaimedDataFor(Consumer* consumer) override {
+            auto consumerCursor = findCursorOf(consumer);
+            if (consumerCursor == nullptr) {
+                return;
+            }
+            auto sequence = consumerCursor->claimedSequence.load(std::memory_order_relaxed);
+            advanceOrDeactivateConsumer(consumer, consumerCursor, sequence + consumerCursor->numberOfClaimedData);
+            consumerCursor->numberOfClaimedData = 0;
+            consumerCursor->claimedSequence.store(NO_CLAIM, std::memory_order_release);
+        }
+
+        /**
+         * @note A consumer that is alone on its buffer may move the claimed data out of its pad.
+         */
+        bool hasSingleConsumer() const noexcept override {
+            return numberOfLinkedConsumers.load(std::memory_order_acquire) == 1;
+        }
+
+        /**
+         * @brief Attaches the consumer, without blocking the writer, even while data are being written. It starts at
+         * the current writer sequence and is activated right away if data were written in the meantime.
+         * @note The links are serialized by the link mutex, so that a consumer linked concurrently gets a single cursor.
+         */
+        void linkWith(Consumer* consumer) override {
+            LockGuard guard(linkMutex);
+            if (findCursorOf(consumer) != nullptr) {
+                return;
+            }
+            auto consumerCursor = addLink(consumer, readWriterSequence());
+            holdBackWriterFor(consumerCursor);
+            if (consumerCursor->sequence.load(std::memory_order_relaxed) != readWriterSequence()) {
+                consumer->activateFor(this);
+            }
+        }
+
+        /**
+         * @brief Detaches the consumer: the writer no longer waits for it, nor notifies it, once this returns.
+         * @warning The consumer shall not be consuming from the buffer meanwhile, e.g.: its scheduler is terminated.
+         */
+        void unlink(Consumer* consumer) override {
+            LockGuard guard(linkMutex);
+            auto consumerCursor = findCursorOf(consumer);
+            if (consumerCursor == nullptr) {
+                return;
+            }
+            consumerCursor->linkState.store(LinkState::UNLINKING);
+            --numberOfLinkedConsumers;
+            while (numberOfNotificationsInProgress.load() != 0) {
+                std::this_thread::yield();
+            }
+            consumerCursor->claimedSequence.store(NO_CLAIM);
+            consumerCursor->linkState.store(LinkState::UNLINKED, std::memory_order_release);
+        }
+
+        /**
+         * @return 0 for a consumer that is not linked, the query does not link it
+         */
+        SequenceNumber fetchNumberOfLostDataFor(Consumer* consumer) override {
+            auto consumerCursor = findCursorOf(consumer);
+            if (consumerCursor == nullptr) {
+                return 0;
+            }
+            return consumerCursor->numberOfLostData.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Back pressure: the buffer is congested once the slowest consumer lags by more than the high watermark,
+         * until it catches up under the low watermark, or while any of its consumers is falling behind.
+         * @note Meant to be polled by the writer to adapt what it produces before data have to be dropped.
+         */
+        bool isCongested() const noexcept {
+            auto writerSequence = readWriterSequence();
+            auto occupancy = writerSequence - readSlowestConsumerSequence(writerSequence);
+            if (occupancy >= HIGH_WATERMARK) {
+                aboveHighWatermark.store(true, std::memory_order_relaxed);
+            } else if (occupancy <= LOW_WATERMARK) {
+                aboveHighWatermark.store(false, std::memory_order_relaxed);
+            }
+            return aboveHighWatermark.load(std::memory_order_relaxed) || isAnyConsumerFallingBehind();
+        }
+
+        /**
+         * @return empty metrics for a consumer that is not linked, the query does not link it
+         */
+        ConsumerMetrics fetchMetricsFor(Consumer* consumer) override {
+            auto consumerCursor = findCursorOf(consumer);
+            if (consumerCursor == nullptr) {
+                return ConsumerMetrics{};
+            }
+            return measure(consumerCursor, readWriterSequence(), readTimeInNanoseconds());
+        }
+
+        /**
+         * @note The gauges are read with relaxed loads while the buffer is in use, the snapshot is not atomic as a whole.
+         */
+        RingBufferMetrics fetchMetrics() const noexcept {
+            RingBufferMetrics metrics{};
+            auto writerSequence = readWriterSequence();
+            auto now = readTimeInNanoseconds();
+            metrics.capacity = CAPACITY;
+            metrics.numberOfWrittenData = writerSequence;
+            metrics.occupancy = std::min<SequenceNumber>(
+                    writerSequence - readSlowestConsumerSequence(writerSequence), CAPACITY);
+            metrics.highestOccupancy = highestOccupancy.load(std::memory_order_relaxed);
+            metrics.writeRate = measureWriteRate(writerSequence);
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots; ++linkIndex) {
+                if (isLinked(linkIndex)) {
+                    metrics.consumers[metrics.numberOfConsumers++] =
+                            measure(&consumerCursors[linkIndex], writerSequence, now);
+                }
+            }
+            return metrics;
+        }
+
+        OverflowPolicy getOverflowPolicy() const noexcept {
+            return overflowPolicy;
+        }
+
+    protected:
+
+        inline RingBufferPad<T>& padAt(SequenceNumber sequence) noexcept {
+            return buffer[sequence & INDEX_MASK];
+        }
+
+        static inline int64_t readTimeInNanoseconds() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    HighResolutionClock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief Keeps the time at which each held data was written, for the lag and write rate gauges. The clock is
+         * read once per write, or per batch, and the times are stored with relaxed stores before being published.
+         */
+        inline void stampWriteTimes(SequenceNumber firstSequence, SequenceNumber numberOfSequences) noexcept {
+            auto now = readTimeInNanoseconds();
+            for (auto sequence = firstSequence; sequence != firstSequence + numberOfSequences; ++sequence) {
+                writeTimes[sequence & INDEX_MASK].store(now, std::memory_order_relaxed);
+            }
+        }
+
+        inline void recordOccupancy(SequenceNumber occupancy) noexcept {
+            auto highest = highestOccupancy.load(std::memory_order_relaxed);
+            while (occupancy > highest &&
+                   !highestOccupancy.compare_exchange_weak(highest, occupancy, std::memory_order_relaxed)) {}
+        }
+
+        ConsumerMetrics measure(ConsumerCursor const* consumerCursor, SequenceNumber writerSequence,
+                                int64_t now) const noexcept {
+            ConsumerMetrics metrics{};
+            auto sequence = consumerCursor->sequence.load(std::memory_order_acquire);
+            metrics.numberOfLostData = consumerCursor->numberOfLostData.load(std::memory_order_relaxed);
+            if (sequence < writerSequence) {
+                metrics.lag = writerSequence - sequence;
+                auto oldestUnconsumedSequence = std::max(sequence, writerSequence - std::min<SequenceNumber>(
+                        writerSequence, CAPACITY));
+                auto writeTime = writeTimes[oldestUnconsumedSequence & INDEX_MASK].load(std::memory_order_relaxed);
+                metrics.lagDuration = castToDuration(std::chrono::nanoseconds(std::max<int64_t>(now - writeTime, 0)));
+            }
+            return metrics;
+        }
+
+        double measureWriteRate(SequenceNumber writerSequence) const noexcept {
+            auto numberOfHeldData = std::min<SequenceNumber>(writerSequence, CAPACITY);
+            if (numberOfHeldData < 2) {
+                return 0;
+            }
+            auto newestWriteTime = writeTimes[(writerSequence - 1) & INDEX_MASK].load(std::memory_order_relaxed);
+            auto oldestWriteTime = writeTimes[(writerSequence - numberOfHeldData) & INDEX_MASK].load(
+                    std::memory_order_relaxed);
+            if (newestWriteTime <= oldestWriteTime) {
+                return 0;
+            }
+            return (numberOfHeldData - 1) * 1e9 / (newestWriteTime - oldestWriteTime);
+        }
+
+        inline SequenceNumber readWriterSequence() const noexcept {
+            return writerCursor.sequence.load(std::memory_order_acquire);
+        }
+
+        inline SequenceNumber countAvailableDataFrom(SequenceNumber sequence, SequenceNumber maximumNumberOfData) const {
+            return std::min<SequenceNumber>(readWriterSequence() - sequence, maximumNumberOfData);
+        }
+
+        DataBatch<T> batchOf(SequenceNumber sequence, SequenceNumber numberOfData) noexcept {
+            auto index = sequence & INDEX_MASK;
+            auto firstSegmentSize = std::min<SequenceNumber>(numberOfData, CAPACITY - index);
+            return DataBatch<T>(&buffer[index], firstSegmentSize, &buffer[0], numberOfData - firstSegmentSize);
+        }
+
+        /**
+         * @note A consumer that was not linked beforehand is linked on its first consumption and starts at the oldest
+         * data still held, or at the oldest one out of reach of the writer when the writer may not overwrite data.
+         * Only the consumptions link, the queries and the releases look the cursor up with findCursorOf.
+         */
+        ConsumerCursor* fetchCursorOf(Consumer* consumer) {
+            auto consumerCursor = findCursorOf(consumer);
+            if (consumerCursor == nullptr) {
+                LockGuard guard(linkMutex);
+                consumerCursor = findCursorOf(consumer);
+                if (consumerCursor == nullptr) {
+                    auto firstSequence = overflowPolicy == OverflowPolicy::DROP_OLDEST
+                                         ? readOldestHeldSequence()
+                                         : readOldestSequenceOutOfReachOfTheWriter();
+                    consumerCursor = addLink(consumer, firstSequence);
+                    holdBackWriterFor(consumerCursor);
+                }
+            }
+            return consumerCursor;
+        }
+
+        /**
+         * @brief Makes the writer account for a consumer just linked, which may be behind the slowest consumer sequence
+         * the writer cached, so that its data are neither overwritten nor dropped from under it.
+         * @details The cached sequence is lowered first. The writer may however have checked its room for the data it
+         * is writing before that, so the consumer is then moved past the pad that data may overwrite.
+         */
+        void holdBackWriterFor(ConsumerCursor* consumerCursor) noexcept {
+            if (overflowPolicy == OverflowPolicy::DROP_OLDEST) {
+                return;
+            }
+            auto sequence = consumerCursor->sequence.load();
+            auto cachedSequence = slowestConsumerSequence.load();
+            while (sequence < cachedSequence &&
+                   !slowestConsumerSequence.compare_exchange_weak(cachedSequence, sequence)) {}
+            auto oldestSequenceOutOfReach = readOldestSequenceOutOfReachOfTheWriter();
+            if (sequence < oldestSequenceOutOfReach) {
+                consumerCursor->sequence.store(oldestSequenceOutOfReach);
+            }
+        }
+
+        ConsumerCursor* findCursorOf(Consumer* consumer) noexcept {
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots; ++linkIndex) {
+                if (isLinked(linkIndex) && linkedConsumers[linkIndex].load(std::memory_order_relaxed) == consumer) {
+                    return &consumerCursors[linkIndex];
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Takes the first unlinked cursor with a compare and swap and prepares it before it is seen as LINKED by
+         * the writer.
+         */
+        ConsumerCursor* addLink(Consumer* consumer, SequenceNumber firstSequence) {
+            for (auto linkIndex = 0u; linkIndex < NUMBER_OF_CONSUMER_PER_BUFFER; ++linkIndex) {
+                auto& consumerCursor = consumerCursors[linkIndex];
+                uint8_t unlinked = LinkState::UNLINKED;
+                if (consumerCursor.linkState.compare_exchange_strong(unlinked, LinkState::LINKING)) {
+                    linkedConsumers[linkIndex].store(consumer, std::memory_order_relaxed);
+                    consumerCursor.sequence.store(firstSequence, std::memory_order_relaxed);
+                    consumerCursor.claimedSequence.store(NO_CLAIM, std::memory_order_relaxed);
+                    consumerCursor.numberOfClaimedData = 0;
+                    consumerCursor.numberOfLostData.store(0, std::memory_order_relaxed);
+                    useConsumerSlotsUpTo(linkIndex + 1);
+                    consumerCursor.linkState.store(LinkState::LINKED);
+                    ++numberOfLinkedConsumers;
+                    return &consumerCursor;
+                }
+            }
+            throwRuntimeError(ExceptionMessage::RING_BUFFER_ILLEGAL_LINKING_MAXIMUM_NUMBER_OF_CONSUMERS_REACHED);
+        }
+
+        void useConsumerSlotsUpTo(uint8_t numberOfConsumerSlots) noexcept {
+            auto slotsInUse = numberOfConsumerSlotsInUse.load(std::memory_order_relaxed);
+            while (numberOfConsumerSlots > slotsInUse &&
+                   !numberOfConsumerSlotsInUse.compare_exchange_weak(slotsInUse, numberOfConsumerSlots)) {}
+        }
+
+        inline bool isLinked(uint8_t linkIndex) const noexcept {
+            return consumerCursors[linkIndex].linkState.load() == LinkState::LINKED;
+        }
+
+        /**
+         * @note The reserved sequence is used so that the pad currently being written is not considered as held.
+         */
+        inline SequenceNumber readOldestHeldSequence() const noexcept {
+            auto reservedSequence = writerCursor.reservedSequence.load();
+            return reservedSequence > CAPACITY ? reservedSequence - CAPACITY : 0;
+        }
+
+        /**
+         * @note The pad of the oldest held sequence may be overwritten by the data being written, whose reservation is
+         * not published yet.
+         */
+        inline SequenceNumber readOldestSequenceOutOfReachOfTheWriter() const noexcept {
+            auto reservedSequence = writerCursor.reservedSequence.load();
+            return reservedSequence >= CAPACITY ? reservedSequence - CAPACITY + 1 : 0;
+        }
+
+        /**
+         * @return false if the data to write has to be dropped
+         */
+        bool makeRoomFor(SequenceNumber sequence) {
+            if (overflowPolicy == OverflowPolicy::DROP_OLDEST) {
+                reserveOverwrittenPad(sequence);
+                return true;
+            }
+            if (!hasRoomFor(sequence)) {
+                if (overflowPolicy == OverflowPolicy::DROP_NEWEST) {
+                    countDataLostByEveryConsumer();
+                    return false;
+                }
+                while (!hasRoomFor(sequence)) {
+                    std::this_thread::yield();
+                }
+            }
+            writerCursor.reservedSequence.store(sequence + 1, std::memory_order_release);
+            return true;
+        }
 
-        void chainPadsInBuffer() {
-            auto firstPad = &buffer[0];
-            auto currentPad = firstPad;
-            RingBufferPad<T>* nextPad;
-            for (auto i = 1; i < RING_BUFFER_SIZE; ++i) {
-                nextPad = &buffer[i];
-                currentPad->setNext(nextPad);
-                currentPad = nextPad;
+        /**
+         * @note The reservation and the claims are sequentially consistent: either the writer sees the claim and waits
+         * for its release, or the claiming consumer sees the reservation and moves on to the oldest held data.
+         */
+        void reserveOverwrittenPad(SequenceNumber sequence) {
+            writerCursor.reservedSequence.store(sequence + 1);
+            if (sequence < CAPACITY) {
+                return;
+            }
+            auto overwrittenSequence = sequence - CAPACITY;
+            while (isClaimedByAnyConsumer(overwrittenSequence)) {
+                std::this_thread::yield();
             }
-            buffer[RING_BUFFER_SIZE - 1].setNext(firstPad);
         }
 
-        void addLinkIfNoneExists(Consumer* consumer) {
-            if (hasNoExistingLinkWith(consumer)) {
-                RingBufferPad<T>* consumerLocation = &buffer[0];
-                auto consumerLocationPair = std::make_pair(consumer, consumerLocation);
-                this->consumerLocationsMap.insert(consumerLocationPair);
+        bool isClaimedByAnyConsumer(SequenceNumber sequence) const noexcept {
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots; ++linkIndex) {
+                if (isLinked(linkIndex) && consumerCursors[linkIndex].claimedSequence.load() <= sequence) {
+                    return true;
+                }
             }
+            return false;
         }
 
-        bool hasNoExistingLinkWith(Consumer* consumer) {
-            return consumerLocationsMap.count(consumer) == 0;
+        SequenceNumber claimNextSequenceFor(ConsumerCursor* consumerCursor) noexcept {
+            SequenceNumber sequence;
+            do {
+                sequence = skipOverwrittenData(consumerCursor);
+                consumerCursor->claimedSequence.store(sequence);
+            } while (sequence < readOldestHeldSequence());
+            return sequence;
         }
 
-        void notifyConsumersIfAnyDataIsPresent() {
-            if (!consumerLocationsMap.empty()) {
-                for (auto location = consumerLocationsMap.begin(), end = consumerLocationsMap.end();
-                     location != end; ++location) {
-                    if (!istWriterLocation((*location).second)) {
-                        (*location).first->activateFor(this);
-                    }
+        /**
+         * @note The slowest consumer sequence is cached so that the consumer cursors are only read when the writer
+         * catches up with the cached value. A consumer linked meanwhile lowers it, see holdBackWriterFor: the cache is
+         * then only replaced by a scan that started after it was lowered.
+         */
+        bool hasRoomFor(SequenceNumber sequence) {
+            auto cachedSequence = slowestConsumerSequence.load();
+            if (sequence - cachedSequence < CAPACITY) {
+                return true;
+            }
+            auto scannedSequence = readSlowestConsumerSequence(sequence);
+            while (!slowestConsumerSequence.compare_exchange_weak(cachedSequence, scannedSequence)) {
+                scannedSequence = readSlowestConsumerSequence(sequence);
+            }
+            return sequence - scannedSequence < CAPACITY;
+        }
+
+        SequenceNumber readSlowestConsumerSequence(SequenceNumber writerSequence) const noexcept {
+            auto slowestSequence = writerSequence;
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots; ++linkIndex) {
+                auto consumerSequence = consumerCursors[linkIndex].sequence.load(std::memory_order_acquire);
+                if (isLinked(linkIndex) && consumerSequence < slowestSequence) {
+                    slowestSequence = consumerSequence;
                 }
             }
+            return slowestSequence;
         }
 
-        bool istWriterLocation(RingBufferPad<T>* pad) const {
-            return pad == writerLocation;
+        void countDataLostByEveryConsumer(SequenceNumber numberOfLostData = 1) noexcept {
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots; ++linkIndex) {
+                if (isLinked(linkIndex)) {
+                    consumerCursors[linkIndex].numberOfLostData.fetch_add(numberOfLostData, std::memory_order_relaxed);
+                }
+            }
         }
 
-        bool isAtWriterLocation(Consumer* consumer) const {
-            return istWriterLocation(consumerLocationsMap.at(consumer));
+        /**
+         * @brief Moves a consumer lapped by the writer to the oldest data still held and counts what it lost.
+         * @return the sequence to read for this consumer
+         */
+        SequenceNumber skipOverwrittenData(ConsumerCursor* consumerCursor) noexcept {
+            auto sequence = consumerCursor->sequence.load(std::memory_order_relaxed);
+            auto oldestHeldSequence = readOldestHeldSequence();
+            if (sequence < oldestHeldSequence) {
+                consumerCursor->numberOfLostData.fetch_add(oldestHeldSequence - sequence, std::memory_order_relaxed);
+                consumerCursor->sequence.store(oldestHeldSequence, std::memory_order_release);
+                sequence = oldestHeldSequence;
+            }
+            return sequence;
+        }
+
+        /**
+         * @note The consumers are only called while the notification is counted as in progress, so that an unlinked
+         * consumer is never called once unlink returned.
+         */
+        bool isAnyConsumerFallingBehind() const noexcept {
+            auto anyConsumerFallingBehind = false;
+            ++numberOfNotificationsInProgress;
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots && !anyConsumerFallingBehind; ++linkIndex) {
+                anyConsumerFallingBehind = isLinked(linkIndex) &&
+                                           linkedConsumers[linkIndex].load(std::memory_order_relaxed)->isFallingBehind();
+            }
+            --numberOfNotificationsInProgress;
+            return anyConsumerFallingBehind;
         }
 
-        auto consumeFor(Consumer* consumer) -> T const& {
-            T const& data = consumerLocationsMap.at(consumer)->read();
-            return data;
+        /**
+         * @note The consumer cursors read to notify the consumers also give the occupancy, so the highest occupancy is
+         * recorded here at no extra cost.
+         */
+        void notifyConsumersIfAnyDataIsPresent(SequenceNumber writtenSequence) {
+            auto slowestSequence = writtenSequence;
+            ++numberOfNotificationsInProgress;
+            auto numberOfConsumerSlots = numberOfConsumerSlotsInUse.load(std::memory_order_acquire);
+            for (auto linkIndex = 0u; linkIndex < numberOfConsumerSlots; ++linkIndex) {
+                if (!isLinked(linkIndex)) {
+                    continue;
+                }
+                auto consumerSequence = consumerCursors[linkIndex].sequence.load(std::memory_order_acquire);
+                if (consumerSequence != writtenSequence) {
+                    linkedConsumers[linkIndex].load(std::memory_order_relaxed)->activateFor(this);
+                }
+                slowestSequence = std::min(slowestSequence, consumerSequence);
+            }
+            --numberOfNotificationsInProgress;
+            recordOccupancy(std::min<SequenceNumber>(writtenSequence - slowestSequence, CAPACITY));
         }
 
-        void throwErrorIfIllegalConsumption(Consumer* consumer) {
-            if (isAtWriterLocation(consumer)) {
+        void throwErrorIfIllegalConsumption(SequenceNumber sequence) const {
+            if (sequence == readWriterSequence()) {
                 // TODO : Find a better way to report the error than this e.g.: logger
                 std::cout << ExceptionMessage::RING_BUFFER_ILLEGAL_CONSUMPTION_ON_WRITER_LOCATION_MESSAGE << std::endl;
 
             }
         }
 
-        void advanceOrDeactivateConsumer(Consumer* consumer) {
-            if (!isAtWriterLocation(consumer)) {
-                consumerLocationsMap.at(consumer) = consumerLocationsMap.at(consumer)->next();
-            }
-            if (isAtWriterLocation(consumer)) {
+        /**
+         * @note A consumer that reaches the writer location is deactivated. If the writer published new data between the
+         * check and the deactivation, the consumer is activated back so that no wake up is lost.
+         */
+        void advanceOrDeactivateConsumer(Consumer* consumer, ConsumerCursor* consumerCursor, SequenceNumber sequence) {
+            consumerCursor->sequence.store(sequence, std::memory_order_release);
+            if (sequence == readWriterSequence()) {
                 consumer->deactivateFor(this);
+                if (sequence != readWriterSequence()) {
+                    consumer->activateFor(this);
+                }
             }
         }
 
-        RingBufferPad<T>* writerLocation;
+        OverflowPolicy const overflowPolicy;
+
+        WriterCursor writerCursor;
+
+    private:
+
+        mutable AtomicFlag aboveHighWatermark;
+
+        AtomicSequenceNumber slowestConsumerSequence;
+
+        AtomicSequenceNumber highestOccupancy;
+
+        std::array<std::atomic<int64_t>, CAPACITY> writeTimes;
+
+        std::array<ConsumerCursor, NUMBER_OF_CONSUMER_PER_BUFFER> consumerCursors;
+
+        std::array<std::atomic<Consumer*>, NUMBER_OF_CONSUMER_PER_BUFFER> linkedConsumers;
+
+        AtomicCounter numberOfLinkedConsumers;
+
+        AtomicCounter numberOfConsumerSlotsInUse;
+
+        mutable AtomicCounter numberOfNotificationsInProgress;
 
-        RingBufferPad<T> buffer[RING_BUFFER_SIZE];
+        Mutex linkMutex;
 
-        ConsumerLocationsMap consumerLocationsMap;
+        RingBufferPad<T> buffer[CAPACITY];
     };
 
 }
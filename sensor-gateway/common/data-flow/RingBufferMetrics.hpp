@@ -0,0 +1,59 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_RINGBUFFERMETRICS_HPP
+#define SENSORGATEWAY_RINGBUFFERMETRICS_HPP
+
+#include "sensor-gateway/common/ConstantValuesDefinition.h"
+
+namespace DataFlow {
+
+    /**
+     * @brief How far a consumer is behind the writer of a ring buffer.
+     * The lag duration is the age of the oldest data the consumer has not consumed yet, zero when it is caught up.
+     */
+    struct ConsumerMetrics {
+        SequenceNumber lag;
+        DurationInNanoseconds lagDuration;
+        SequenceNumber numberOfLostData;
+    };
+
+    /**
+     * @brief Snapshot of the gauges of a ring buffer.
+     * The occupancy is the lag of the slowest consumer, the highest occupancy is the highest one observed by the writer
+     * since the creation of the buffer. The write rate, in data per second, is measured over the data currently held.
+     */
+    struct RingBufferMetrics {
+        size_t capacity;
+        SequenceNumber numberOfWrittenData;
+        SequenceNumber occupancy;
+        SequenceNumber highestOccupancy;
+        double writeRate;
+        uint8_t numberOfConsumers;
+        std::array<ConsumerMetrics, MAXIMUM_NUMBER_OF_CONSUMERS_PER_RING_BUFFER> consumers;
+    };
+
+    /**
+     * @brief Snapshot of the lag of a DataProcessingScheduler on each of its inputs, in link order.
+     */
+    template<uint8_t NUMBER_OF_INPUTS>
+    struct SchedulerMetrics {
+        uint8_t numberOfInputs;
+        std::array<ConsumerMetrics, NUMBER_OF_INPUTS> inputs;
+    };
+}
+
+#endif //SENSORGATEWAY_RINGBUFFERMETRICS_HPP
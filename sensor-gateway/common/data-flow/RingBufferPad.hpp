@@ -18,27 +18,39 @@
 #ifndef SENSORGATEWAY_RINGBUFFERPAD_HPP
 #define SENSORGATEWAY_RINGBUFFERPAD_HPP
 
+#include "sensor-gateway/common/TypeDefinition.h"
 
 namespace DataFlow {
 
     /**
+     * @brief Holds uninitialised storage for one data. The data is move constructed by the first write and move
+     * assigned by the following ones, so that pads that are never written never touch their memory.
      * @warning Concurrency Warning: No thread safety has been implemented in this class. This is the responsibility of
      * the RingBuffer.
      */
     template<class T>
     class RingBufferPad {
 
+        typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
     public:
 
-        RingBufferPad() : nextPadSet(false), currentData(T::returnDefaultData()), nextPad(this) {}
+        RingBufferPad() : constructed(false) {}
 
-        ~RingBufferPad() = default;
+        ~RingBufferPad() {
+            if (constructed) {
+                data()->~T();
+            }
+        }
 
         /**
          * @warning The RingBufferPads are intended to be used as const instances. They shouldn't be moved.
          */
-        RingBufferPad(RingBufferPad&& other) noexcept = default;
-
+        RingBufferPad(RingBufferPad&& other) noexcept : constructed(false) {
+            if (other.constructed) {
+                write(std::move(*other.data()));
+            }
+        }
 
         /**
          * @warning The RingBufferPads are intended to be used as const instances. They shouldn't be copied.
@@ -56,32 +68,50 @@ namespace DataFlow {
         RingBufferPad& operator=(RingBufferPad&& other) = delete;
 
 
-        void setNext(RingBufferPad* nextBufferPad) {
-            if (!nextPadSet) {
-                nextPad = nextBufferPad;
-                nextPadSet = !nextPadSet;
+        void write(T&& dataToWrite) {
+            if (constructed) {
+                *data() = std::move(dataToWrite);
+            } else {
+                new(&storage) T(std::move(dataToWrite));
+                constructed = true;
             }
         }
 
-        RingBufferPad* next() {
-            return nextPad;
-        }
-
-        void write(T&& dataToWrite) {
-            currentData = dataToWrite;
+        /**
+         * @note A pad that has never been written reads as the default data.
+         */
+        auto read() const -> T const& {
+            if (!constructed) {
+                static T const DEFAULT_DATA = T::returnDefaultData();
+                return DEFAULT_DATA;
+            }
+            return *data();
         }
 
-        auto read() const -> T const& {
-            return currentData;
+        /**
+         * @note A pad that has never been written is filled with the default data before being read.
+         */
+        auto read() -> T& {
+            if (!constructed) {
+                new(&storage) T(T::returnDefaultData());
+                constructed = true;
+            }
+            return *data();
         }
 
     protected:
 
-        bool nextPadSet;
+        T* data() noexcept {
+            return reinterpret_cast<T*>(&storage);
+        }
+
+        T const* data() const noexcept {
+            return reinterpret_cast<T const*>(&storage);
+        }
 
-        T currentData;
+        Storage storage;
 
-        RingBufferPad<T>* nextPad;
+        bool constructed;
     };
 }
 
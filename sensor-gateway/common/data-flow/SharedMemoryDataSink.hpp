@@ -0,0 +1,69 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_SHAREDMEMORYDATASINK_HPP
+#define SENSORGATEWAY_SHAREDMEMORYDATASINK_HPP
+
+#include "DataSink.hpp"
+#include "SharedMemoryRingBuffer.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief Publishes the data it consumes in a SharedMemoryRingBuffer, so that local processes can read them with a
+     * SharedMemoryReader. Link it to a DataSource through a DataProcessingScheduler, as any other DataSink.
+     * @tparam SLOT the flat image of T written in the shared memory, built in place with SLOT::copyFrom(T const&)
+     */
+    template<class T, class SLOT, size_t CAPACITY = RING_BUFFER_SIZE>
+    class SharedMemoryDataSink final : public DataSink<T> {
+
+    protected:
+
+        using super = DataSink<T>;
+        using typename super::DATA;
+
+    public:
+
+        explicit SharedMemoryDataSink(std::string const& segmentName) :
+                sharedMemoryRingBuffer(segmentName) {}
+
+        ~SharedMemoryDataSink() noexcept = default;
+
+        SharedMemoryDataSink(SharedMemoryDataSink const& other) = delete;
+
+        SharedMemoryDataSink(SharedMemoryDataSink&& other) noexcept = delete;
+
+        SharedMemoryDataSink& operator=(SharedMemoryDataSink const& other)& = delete;
+
+        SharedMemoryDataSink& operator=(SharedMemoryDataSink&& other)& noexcept = delete;
+
+        void consume(DATA&& data) override {
+            sharedMemoryRingBuffer.writeWith([&data](SLOT& slot) {
+                slot.copyFrom(data);
+            });
+        }
+
+        uint8_t fetchNumberOfAttachedReaders() const noexcept {
+            return sharedMemoryRingBuffer.fetchNumberOfAttachedReaders();
+        }
+
+    private:
+
+        SharedMemoryRingBuffer<SLOT, CAPACITY> sharedMemoryRingBuffer;
+    };
+}
+
+#endif //SENSORGATEWAY_SHAREDMEMORYDATASINK_HPP
@@ -0,0 +1,428 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_SHAREDMEMORYRINGBUFFER_HPP
+#define SENSORGATEWAY_SHAREDMEMORYRINGBUFFER_HPP
+
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "sensor-gateway/common/ConstantFunctionsDefinition.h"
+#include "sensor-gateway/common/ExceptionMessages.h"
+
+namespace DataFlow {
+
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2 && sizeof(pid_t) == sizeof(int),
+                  "The shared memory ring buffers need address free atomics to be shared between processes");
+
+    /**
+     * @brief Named POSIX shared memory segment mapped in the calling process. The creator owns the name and unlinks it
+     * when destroyed, the processes that open it only unmap it.
+     */
+    class SharedMemorySegment {
+
+    public:
+
+        /**
+         * @warning Never takes over an existing segment: a segment left by a crashed creator has to be removed first,
+         * see removeStale.
+         */
+        static SharedMemorySegment create(std::string const& name, size_t size) {
+            auto fileDescriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            if (fileDescriptor == INVALID_FILE_DESCRIPTOR) {
+                throwRuntimeError(errno == EEXIST ? ExceptionMessage::SHARED_MEMORY_SEGMENT_ALREADY_EXISTS
+                                                  : ExceptionMessage::SHARED_MEMORY_SEGMENT_CREATION_FAILED);
+            }
+            if (ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0) {
+                close(fileDescriptor);
+                shm_unlink(name.c_str());
+                throwRuntimeError(ExceptionMessage::SHARED_MEMORY_SEGMENT_CREATION_FAILED);
+            }
+            return SharedMemorySegment(name, fileDescriptor, size, true);
+        }
+
+        /**
+         * @brief Recovery of a segment left behind by a creator that did not get to unlink it, e.g.: after a crash.
+         * The processes that still map it keep their mapping, they just no longer see the data of the new creator.
+         * @warning Only call it once the creator of the segment is known to be dead.
+         */
+        static void removeStale(std::string const& name) noexcept {
+            shm_unlink(name.c_str());
+        }
+
+        /**
+         * @note Only a segment of exactly the given size is mapped: touching the mapping beyond the end of a smaller
+         * segment, e.g.: one not yet sized by its creator, would kill the process with a SIGBUS.
+         */
+        static SharedMemorySegment open(std::string const& name, size_t size) {
+            auto fileDescriptor = shm_open(name.c_str(), O_RDWR, 0);
+            if (fileDescriptor == INVALID_FILE_DESCRIPTOR) {
+                throwRuntimeError(ExceptionMessage::SHARED_MEMORY_SEGMENT_OPENING_FAILED);
+            }
+            struct stat segmentStatus{};
+            if (fstat(fileDescriptor, &segmentStatus) != 0 || static_cast<size_t>(segmentStatus.st_size) != size) {
+                close(fileDescriptor);
+                throwRuntimeError(ExceptionMessage::SHARED_MEMORY_SEGMENT_OPENING_FAILED);
+            }
+            return SharedMemorySegment(name, fileDescriptor, size, false);
+        }
+
+        ~SharedMemorySegment() noexcept {
+            if (address != nullptr) {
+                munmap(address, size);
+                if (ownsName) {
+                    shm_unlink(name.c_str());
+                }
+            }
+        }
+
+        SharedMemorySegment(SharedMemorySegment&& other) noexcept :
+                name(std::move(other.name)),
+                size(other.size),
+                address(other.address),
+                ownsName(other.ownsName) {
+            other.address = nullptr;
+        }
+
+        /**
+         * @warning The SharedMemorySegments own their mapping. They shouldn't be copied.
+         */
+        SharedMemorySegment(SharedMemorySegment const& other) = delete;
+
+        /**
+         * @warning The SharedMemorySegments own their mapping. They shouldn't be assigned.
+         */
+        SharedMemorySegment& operator=(SharedMemorySegment const& other) = delete;
+
+        /**
+         * @warning The SharedMemorySegments own their mapping. They shouldn't be assigned.
+         */
+        SharedMemorySegment& operator=(SharedMemorySegment&& other) = delete;
+
+        void* getAddress() const noexcept {
+            return address;
+        }
+
+    private:
+
+        static int const INVALID_FILE_DESCRIPTOR = -1;
+
+        SharedMemorySegment(std::string const& name, int fileDescriptor, size_t size, bool ownsName) :
+                name(name),
+                size(size),
+                address(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0)),
+                ownsName(ownsName) {
+            close(fileDescriptor);
+            if (address == MAP_FAILED) {
+                address = nullptr;
+                if (ownsName) {
+                    shm_unlink(name.c_str());
+                }
+                throwRuntimeError(ExceptionMessage::SHARED_MEMORY_SEGMENT_MAPPING_FAILED);
+            }
+        }
+
+        std::string name;
+        size_t size;
+        void* address;
+        bool ownsName;
+    };
+
+    /**
+     * @brief Layout of a shared memory ring buffer, identical in the gateway and in the reading processes.
+     * Every slot carries the sequence of the data it holds, it is cleared while the slot is being written so that a
+     * reader can tell whether the data it read was overwritten under its feet.
+     */
+    template<class SLOT, size_t CAPACITY>
+    struct SharedMemoryRingBufferLayout {
+
+        static_assert(CAPACITY != 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                      "The SharedMemoryRingBuffer CAPACITY must be a power of two");
+        static_assert(std::is_trivially_copyable<SLOT>::value,
+                      "The SharedMemoryRingBuffer slots are shared with other processes, they must be trivially copyable");
+
+        static uint64_t const MAGIC_NUMBER = 0x53475348524D5242; // "SGSHRMRB"
+        static uint8_t const MAXIMUM_NUMBER_OF_READERS = 8;
+        static SequenceNumber const INDEX_MASK = CAPACITY - 1;
+        static SequenceNumber const BEING_WRITTEN = std::numeric_limits<SequenceNumber>::max();
+        static pid_t const DETACHED = 0;
+
+        /**
+         * @brief Cursor of a SharedMemoryReader, held by the process that attached it. The cursor of a process that
+         * died without detaching it is reclaimed by the next reader that finds no detached cursor.
+         */
+        struct alignas(CACHE_LINE_SIZE) ReaderCursor {
+            std::atomic<pid_t> ownerProcessId;
+            AtomicSequenceNumber sequence;
+            AtomicSequenceNumber numberOfLostData;
+
+            bool isHeldByADeadProcess() const noexcept {
+                auto owner = ownerProcessId.load(std::memory_order_acquire);
+                return owner != DETACHED && kill(owner, 0) != 0 && errno == ESRCH;
+            }
+
+            bool isAttached() const noexcept {
+                return ownerProcessId.load(std::memory_order_acquire) != DETACHED && !isHeldByADeadProcess();
+            }
+        };
+
+        struct alignas(CACHE_LINE_SIZE) Slot {
+            AtomicSequenceNumber sequence;
+            SLOT data;
+        };
+
+        uint64_t magicNumber;
+        uint64_t capacity;
+        uint64_t slotSize;
+        alignas(CACHE_LINE_SIZE) AtomicSequenceNumber writerSequence;
+        ReaderCursor readerCursors[MAXIMUM_NUMBER_OF_READERS];
+        Slot slots[CAPACITY];
+
+        bool isCompatible() const noexcept {
+            return magicNumber == MAGIC_NUMBER && capacity == CAPACITY && slotSize == sizeof(SLOT);
+        }
+    };
+
+    /**
+     * @brief Single producer ring buffer whose slots live in a named shared memory segment, so that local processes can
+     * read the data without serialisation, see SharedMemoryReader.
+     * The readers never hold back the writer: a lapped reader skips to the oldest data still held and counts what it
+     * lost, as with the DROP_OLDEST OverflowPolicy.
+     * @tparam SLOT the flat, trivially copyable, representation of the shared data
+     * @warning Concurrency Warning: Only one thread shall write to a SharedMemoryRingBuffer.
+     */
+    template<class SLOT, size_t CAPACITY>
+    class SharedMemoryRingBuffer {
+
+        using Layout = SharedMemoryRingBufferLayout<SLOT, CAPACITY>;
+
+    public:
+
+        explicit SharedMemoryRingBuffer(std::string const& segmentName) :
+                segment(SharedMemorySegment::create(segmentName, sizeof(Layout))),
+                layout(static_cast<Layout*>(segment.getAddress())),
+                sequence(0) {
+            layout->magicNumber = Layout::MAGIC_NUMBER;
+            layout->capacity = CAPACITY;
+            layout->slotSize = sizeof(SLOT);
+            layout->writerSequence.store(0);
+            for (auto& readerCursor : layout->readerCursors) {
+                readerCursor.ownerProcessId.store(Layout::DETACHED);
+            }
+            for (auto& slot : layout->slots) {
+                slot.sequence.store(Layout::BEING_WRITTEN);
+            }
+        }
+
+        ~SharedMemoryRingBuffer() noexcept = default;
+
+        /**
+         * @warning The SharedMemoryRingBuffers are intended to be used as const instances. They shouldn't be moved.
+         */
+        SharedMemoryRingBuffer(SharedMemoryRingBuffer&& other) = delete;
+
+        /**
+         * @warning The SharedMemoryRingBuffers are intended to be used as const instances. They shouldn't be copied.
+         */
+        SharedMemoryRingBuffer(SharedMemoryRingBuffer const& other) = delete;
+
+        /**
+         * @warning The SharedMemoryRingBuffers are intended to be used as const instances. They shouldn't be assigned.
+         */
+        SharedMemoryRingBuffer& operator=(SharedMemoryRingBuffer const& other) = delete;
+
+        /**
+         * @warning The SharedMemoryRingBuffers are intended to be used as const instances. They shouldn't be assigned.
+         */
+        SharedMemoryRingBuffer& operator=(SharedMemoryRingBuffer&& other) = delete;
+
+        void write(SLOT const& data) {
+            writeWith([&data](SLOT& slot) {
+                slot = data;
+            });
+        }
+
+        /**
+         * @brief Lets the given function fill the next slot in place, so that the data is written straight in the
+         * shared memory.
+         */
+        template<class FILL>
+        void writeWith(FILL&& fill) {
+            auto& slot = layout->slots[sequence & Layout::INDEX_MASK];
+            slot.sequence.store(Layout::BEING_WRITTEN, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            fill(slot.data);
+            slot.sequence.store(sequence, std::memory_order_release);
+            ++sequence;
+            layout->writerSequence.store(sequence, std::memory_order_release);
+        }
+
+        /**
+         * @note The readers of the processes that died without detaching are not counted.
+         */
+        uint8_t fetchNumberOfAttachedReaders() const noexcept {
+            uint8_t numberOfAttachedReaders = 0;
+            for (auto const& readerCursor : layout->readerCursors) {
+                numberOfAttachedReaders += readerCursor.isAttached();
+            }
+            return numberOfAttachedReaders;
+        }
+
+    private:
+
+        SharedMemorySegment segment;
+        Layout* layout;
+        SequenceNumber sequence;
+    };
+
+    /**
+     * @brief Reading side of a SharedMemoryRingBuffer, meant to be used by the processes running next to the gateway.
+     * It attaches as an extra consumer cursor of the ring, visible to the gateway, that never holds back the writer.
+     * @warning Concurrency Warning: A SharedMemoryReader shall only be used by one thread at a time.
+     */
+    template<class SLOT, size_t CAPACITY>
+    class SharedMemoryReader {
+
+        using Layout = SharedMemoryRingBufferLayout<SLOT, CAPACITY>;
+        using ReaderCursor = typename Layout::ReaderCursor;
+
+    public:
+
+        enum ReadStatus : uint8_t {
+            READ,
+            NO_DATA,
+            OVERWRITTEN_WHILE_READ,
+        };
+
+        explicit SharedMemoryReader(std::string const& segmentName) :
+                segment(SharedMemorySegment::open(segmentName, sizeof(Layout))),
+                layout(static_cast<Layout*>(segment.getAddress())),
+                readerCursor(nullptr) {
+            if (!layout->isCompatible()) {
+                throwRuntimeError(ExceptionMessage::SHARED_MEMORY_RING_BUFFER_INCOMPATIBLE_LAYOUT);
+            }
+            readerCursor = attachReaderCursor();
+        }
+
+        ~SharedMemoryReader() noexcept {
+            readerCursor->ownerProcessId.store(Layout::DETACHED, std::memory_order_release);
+        }
+
+        /**
+         * @warning The SharedMemoryReaders are intended to be used as const instances. They shouldn't be moved.
+         */
+        SharedMemoryReader(SharedMemoryReader&& other) = delete;
+
+        /**
+         * @warning The SharedMemoryReaders are intended to be used as const instances. They shouldn't be copied.
+         */
+        SharedMemoryReader(SharedMemoryReader const& other) = delete;
+
+        /**
+         * @warning The SharedMemoryReaders are intended to be used as const instances. They shouldn't be assigned.
+         */
+        SharedMemoryReader& operator=(SharedMemoryReader const& other) = delete;
+
+        /**
+         * @warning The SharedMemoryReaders are intended to be used as const instances. They shouldn't be assigned.
+         */
+        SharedMemoryReader& operator=(SharedMemoryReader&& other) = delete;
+
+        /**
+         * @brief Gives the next data to the visitor. The data is copied out of the shared memory and only visited
+         * once the copy is known to be whole, so that the visitor never sees a torn slot, e.g.: a count of tracks that
+         * does not match the tracks.
+         * @return OVERWRITTEN_WHILE_READ when the writer lapped the reader during the copy: the visitor is not called
+         * and the data is counted as lost.
+         */
+        template<class VISITOR>
+        ReadStatus readNext(VISITOR&& visitor) {
+            auto sequence = skipOverwrittenData();
+            if (sequence == layout->writerSequence.load(std::memory_order_acquire)) {
+                return ReadStatus::NO_DATA;
+            }
+            auto const& slot = layout->slots[sequence & Layout::INDEX_MASK];
+            auto status = ReadStatus::OVERWRITTEN_WHILE_READ;
+            if (slot.sequence.load(std::memory_order_acquire) == sequence) {
+                SLOT const data(slot.data);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == sequence) {
+                    status = ReadStatus::READ;
+                    visitor(data);
+                }
+            }
+            if (status == ReadStatus::OVERWRITTEN_WHILE_READ) {
+                readerCursor->numberOfLostData.fetch_add(1, std::memory_order_relaxed);
+            }
+            readerCursor->sequence.store(sequence + 1, std::memory_order_release);
+            return status;
+        }
+
+        SequenceNumber fetchNumberOfLostData() const noexcept {
+            return readerCursor->numberOfLostData.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        ReaderCursor* attachReaderCursor() {
+            for (auto& cursor : layout->readerCursors) {
+                pid_t detached = Layout::DETACHED;
+                if (claim(cursor, detached)) {
+                    return &cursor;
+                }
+            }
+            for (auto& cursor : layout->readerCursors) {
+                auto deadOwner = cursor.ownerProcessId.load(std::memory_order_acquire);
+                if (cursor.isHeldByADeadProcess() && claim(cursor, deadOwner)) {
+                    return &cursor;
+                }
+            }
+            throwRuntimeError(ExceptionMessage::SHARED_MEMORY_RING_BUFFER_MAXIMUM_NUMBER_OF_READERS_REACHED);
+        }
+
+        bool claim(ReaderCursor& cursor, pid_t expectedOwner) noexcept {
+            if (!cursor.ownerProcessId.compare_exchange_strong(expectedOwner, getpid())) {
+                return false;
+            }
+            cursor.sequence.store(layout->writerSequence.load(std::memory_order_acquire));
+            cursor.numberOfLostData.store(0);
+            return true;
+        }
+
+        SequenceNumber skipOverwrittenData() noexcept {
+            auto sequence = readerCursor->sequence.load(std::memory_order_relaxed);
+            auto writerSequence = layout->writerSequence.load(std::memory_order_acquire);
+            if (writerSequence - sequence > CAPACITY) {
+                auto oldestHeldSequence = writerSequence - CAPACITY;
+                readerCursor->numberOfLostData.fetch_add(oldestHeldSequence - sequence, std::memory_order_relaxed);
+                sequence = oldestHeldSequence;
+            }
+            return sequence;
+        }
+
+        SharedMemorySegment segment;
+        Layout* layout;
+        ReaderCursor* readerCursor;
+    };
+}
+
+#endif //SENSORGATEWAY_SHAREDMEMORYRINGBUFFER_HPP
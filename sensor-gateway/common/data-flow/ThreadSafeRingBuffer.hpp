@@ -23,45 +23,156 @@
 namespace DataFlow {
 
     /**
+     * @brief Multiple producers, multiple consumers ring buffer.
+     * The writers claim their sequences with an atomic operation on the reserved sequence and write their pads
+     * concurrently. Each written pad is then flagged with its sequence, and the writers advance the published sequence
+     * over every contiguous flagged pad. The consumers only ever see that published sequence, so they are served
+     * exactly as by a RingBuffer.
+     * @note The writers never reserve more than CAPACITY sequences ahead of the published sequence, so that a pad
+     * still being written by a slow writer is never handed over to another one.
      * @warning Use this class ONLY when more than one thread needs to write to the RingBuffer
      */
-    template<class T>
-    class ThreadSafeRingBuffer : public RingBuffer<T> {
-        using super = RingBuffer<T>;
+    template<class T, size_t CAPACITY = RING_BUFFER_SIZE>
+    class ThreadSafeRingBuffer : public RingBuffer<T, CAPACITY> {
+        using super = RingBuffer<T, CAPACITY>;
+
+        using super::NO_CLAIM;
+        using super::INDEX_MASK;
 
     public:
 
-        ThreadSafeRingBuffer() : super() {
+        explicit ThreadSafeRingBuffer(OverflowPolicy overflowPolicy = OverflowPolicy::DROP_OLDEST) :
+                super(overflowPolicy) {
+            for (auto& publishedSequence : publishedSequences) {
+                publishedSequence.store(NO_CLAIM);
+            }
         }
 
-        ThreadSafeRingBuffer(ThreadSafeRingBuffer&& other) noexcept = default;
-
         virtual ~ThreadSafeRingBuffer() = default;
 
         /**
-         * @brief The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be assigned.
+         * @warning The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be moved.
+         */
+        ThreadSafeRingBuffer(ThreadSafeRingBuffer&& other) noexcept = delete;
+
+        /**
+         * @warning The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be assigned.
          */
         ThreadSafeRingBuffer(ThreadSafeRingBuffer const& other) = delete;
 
         /**
-         * @brief The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be assigned.
+         * @warning The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be assigned.
          */
         ThreadSafeRingBuffer& operator=(ThreadSafeRingBuffer const& other) = delete;
 
         /**
-         * @brief The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be copied.
+         * @warning The ThreadSafeRingBuffers are intended to be used as const instances. They shouldn't be copied.
          */
         ThreadSafeRingBuffer& operator=(ThreadSafeRingBuffer&& other) = delete;
 
         void write(T&& data) override {
-            LockGuard guard(writeMutex);
-            super::write(std::forward(data));
+            auto sequence = claimSequences(1);
+            if (sequence.numberOfClaimedSequences == 0) {
+                super::countDataLostByEveryConsumer();
+                return;
+            }
+            super::padAt(sequence.first).write(std::forward<T>(data));
+            publish(sequence.first, 1);
+        }
+
+        /**
+         * @brief Claims as many sequences as possible at once for the data of the range, writes them, moving from
+         * them, then publishes them together.
+         */
+        template<class ITERATOR>
+        void writeBatch(ITERATOR firstData, ITERATOR lastData) {
+            auto data = firstData;
+            while (data != lastData) {
+                auto sequences = claimSequences(static_cast<SequenceNumber>(std::distance(data, lastData)));
+                if (sequences.numberOfClaimedSequences == 0) {
+                    super::countDataLostByEveryConsumer(static_cast<SequenceNumber>(std::distance(data, lastData)));
+                    return;
+                }
+                auto lastSequence = sequences.first + sequences.numberOfClaimedSequences;
+                for (auto sequence = sequences.first; sequence != lastSequence; ++sequence, ++data) {
+                    super::padAt(sequence).write(std::move(*data));
+                }
+                publish(sequences.first, sequences.numberOfClaimedSequences);
+            }
         }
 
     private:
-        Mutex writeMutex;
-    };
 
+        struct ClaimedSequences {
+            SequenceNumber first;
+            SequenceNumber numberOfClaimedSequences;
+        };
 
+        /**
+         * @return the claimed sequences, none if the data have to be dropped
+         */
+        ClaimedSequences claimSequences(SequenceNumber numberOfWantedSequences) {
+            auto& reservedSequence = super::writerCursor.reservedSequence;
+            auto sequence = reservedSequence.load();
+            while (true) {
+                auto room = CAPACITY - (sequence - super::writerCursor.sequence.load());
+                if (super::getOverflowPolicy() != OverflowPolicy::DROP_OLDEST) {
+                    auto consumersRoom = CAPACITY - (sequence - super::readSlowestConsumerSequence(sequence));
+                    if (consumersRoom == 0 && super::getOverflowPolicy() == OverflowPolicy::DROP_NEWEST) {
+                        return {sequence, 0};
+                    }
+                    room = std::min<SequenceNumber>(room, consumersRoom);
+                }
+                if (room == 0) {
+                    std::this_thread::yield();
+                    sequence = reservedSequence.load();
+                    continue;
+                }
+                auto numberOfClaimedSequences = std::min<SequenceNumber>(room, numberOfWantedSequences);
+                if (reservedSequence.compare_exchange_weak(sequence, sequence + numberOfClaimedSequences)) {
+                    waitForClaimsOnOverwrittenPads(sequence, numberOfClaimedSequences);
+                    return {sequence, numberOfClaimedSequences};
+                }
+            }
+        }
+
+        /**
+         * @note Same handshake as the RingBuffer: the reservation is sequentially consistent with the claims, so either
+         * the writer sees the claim and waits for its release, or the consumer sees the reservation and moves on.
+         */
+        void waitForClaimsOnOverwrittenPads(SequenceNumber firstSequence, SequenceNumber numberOfSequences) const {
+            for (auto sequence = firstSequence; sequence != firstSequence + numberOfSequences; ++sequence) {
+                while (sequence >= CAPACITY && super::isClaimedByAnyConsumer(sequence - CAPACITY)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void publish(SequenceNumber firstSequence, SequenceNumber numberOfSequences) {
+            super::stampWriteTimes(firstSequence, numberOfSequences);
+            for (auto sequence = firstSequence; sequence != firstSequence + numberOfSequences; ++sequence) {
+                publishedSequences[sequence & INDEX_MASK].store(sequence);
+            }
+            auto publishedSequence = advancePublishedSequence();
+            super::notifyConsumersIfAnyDataIsPresent(publishedSequence);
+        }
+
+        /**
+         * @brief Moves the published sequence over every contiguous written pad, including those of the other writers.
+         * A writer that stops on a pad still being written leaves the rest to the writer of that pad.
+         */
+        SequenceNumber advancePublishedSequence() {
+            auto& writerSequence = super::writerCursor.sequence;
+            auto sequence = writerSequence.load();
+            while (publishedSequences[sequence & INDEX_MASK].load() == sequence) {
+                if (writerSequence.compare_exchange_weak(sequence, sequence + 1)) {
+                    ++sequence;
+                }
+            }
+            return sequence;
+        }
+
+        std::array<AtomicSequenceNumber, CAPACITY> publishedSequences;
+    };
 }
 #endif //SENSORGATEWAY_THREADSAFERINGBUFFER_H
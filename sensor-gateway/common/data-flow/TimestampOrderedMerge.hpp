@@ -0,0 +1,219 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_TIMESTAMPORDEREDMERGE_HPP
+#define SENSORGATEWAY_TIMESTAMPORDEREDMERGE_HPP
+
+#include <vector>
+
+#include "DataProcessingScheduler.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief Acquisition time of a data carrying a TimeTracking: its first sensor time point, or its first gateway time
+     * point when the sensor gives none.
+     */
+    struct TimeTrackedAcquisitionTime {
+
+        template<class T>
+        HighResolutionTimePoint operator()(T& data) const noexcept {
+            auto const& sensorTimestamps = data.getSensorTimestamps();
+            if (sensorTimestamps.getCurrentNumberOfTimePoints() != 0) {
+                return sensorTimestamps.getTimePoints()[0].timestamp;
+            }
+            auto const& gatewayTimestamps = data.getGatewayTimestamps();
+            if (gatewayTimestamps.getCurrentNumberOfTimePoints() != 0) {
+                return gatewayTimestamps.getTimePoints()[0].timestamp;
+            }
+            return Metrics::BEGINNING_OF_TIME_ITSELF;
+        }
+    };
+
+    /**
+     * @brief Fan-in stage merging the data of several sources, e.g.: the sensors of a rig, into a single DataSource
+     * ordered by acquisition time.
+     * The data wait in a reorder window, a heap ordered by acquisition time, until either the window is full or the
+     * earliest data was acquired longer than the latency deadline ago. A data reaching the window after a later one was
+     * produced is still produced, and counted as out of order.
+     * @tparam ACQUISITION_TIME function object giving the acquisition time of a data, see TimeTrackedAcquisitionTime
+     * @note The deadline is checked whenever data reach the merge and, while its inputs are idle, by its input
+     * scheduler. When the merge is run by an executor, flushExpired shall be called periodically instead, since no
+     * thread waits on its idle inputs. flush produces whatever is left in the window.
+     */
+    template<class T, size_t NUMBER_OF_INPUTS, size_t REORDER_WINDOW_SIZE = MAXIMUM_NUMBER_OF_DATA_PER_BATCH,
+            size_t CAPACITY = RING_BUFFER_SIZE, class ACQUISITION_TIME = TimeTrackedAcquisitionTime>
+    class TimestampOrderedMerge final : public DataSink<T>,
+                                        public DataSource<T, CAPACITY> {
+
+        static_assert(REORDER_WINDOW_SIZE != 0, "The TimestampOrderedMerge reorder window cannot be empty");
+
+    protected:
+
+        using ThisClass = TimestampOrderedMerge<T, NUMBER_OF_INPUTS, REORDER_WINDOW_SIZE, CAPACITY, ACQUISITION_TIME>;
+        using InputScheduler = DataProcessingScheduler<T, ThisClass, NUMBER_OF_INPUTS, SpinThenYieldWaitStrategy>;
+        using OutputSource = DataSource<T, CAPACITY>;
+
+        /**
+         * @note The arrival sequence breaks the ties, so that data acquired at the same time keep their arrival order.
+         */
+        struct PendingData {
+            HighResolutionTimePoint acquisitionTime;
+            SequenceNumber arrivalSequence;
+            T data;
+
+            bool operator>(PendingData const& other) const noexcept {
+                return acquisitionTime > other.acquisitionTime ||
+                       (acquisitionTime == other.acquisitionTime && arrivalSequence > other.arrivalSequence);
+            }
+        };
+
+    public:
+
+        explicit TimestampOrderedMerge(std::chrono::nanoseconds latencyDeadline,
+                                       WorkStealingExecutor* executor = nullptr) :
+                latencyDeadline(latencyDeadline),
+                numberOfArrivedData(0),
+                numberOfOutOfOrderData(0),
+                lastProducedAcquisitionTime(Metrics::BEGINNING_OF_TIME_ITSELF),
+                inputScheduler(this, executor) {
+            reorderWindow.reserve(REORDER_WINDOW_SIZE);
+        }
+
+        ~TimestampOrderedMerge() noexcept = default;
+
+        TimestampOrderedMerge(TimestampOrderedMerge const& other) = delete;
+
+        TimestampOrderedMerge(TimestampOrderedMerge&& other) noexcept = delete;
+
+        TimestampOrderedMerge& operator=(TimestampOrderedMerge const& other)& = delete;
+
+        TimestampOrderedMerge& operator=(TimestampOrderedMerge&& other)& noexcept = delete;
+
+        /**
+         * @param inputSource any DataSource of T, or anything exposing linkConsumer(ConsumerLink<T>*)
+         */
+        template<class INPUT_SOURCE>
+        void linkInput(INPUT_SOURCE* inputSource) {
+            inputSource->linkConsumer(&inputScheduler);
+        }
+
+        void consume(T&& data) override {
+            LockGuard guard(reorderWindowMutex);
+            hold(std::move(data));
+            produceReleasedData(HighResolutionClock::now());
+        }
+
+        /**
+         * @note The whole batch enters the window before anything is released, so that the data of the batch are
+         * ordered among themselves.
+         */
+        void consumeBatch(DataBatch<T>& batch) override {
+            LockGuard guard(reorderWindowMutex);
+            batch.forEach([this](T& data) {
+                hold(std::move(data));
+            });
+            produceReleasedData(HighResolutionClock::now());
+        }
+
+        void handleIdleInputs() override {
+            flushExpired(HighResolutionClock::now());
+        }
+
+        bool isFallingBehind() const noexcept override {
+            return OutputSource::isOutputCongested();
+        }
+
+        /**
+         * @brief Produces every data left in the reorder window, in order.
+         */
+        void flush() {
+            LockGuard guard(reorderWindowMutex);
+            while (!reorderWindow.empty()) {
+                produceEarliestData();
+            }
+        }
+
+        /**
+         * @brief Produces, in order, the data of the reorder window acquired longer than the latency deadline before
+         * the given time.
+         */
+        void flushExpired(HighResolutionTimePoint const& now) {
+            LockGuard guard(reorderWindowMutex);
+            produceReleasedData(now);
+        }
+
+        void terminateAndJoin() {
+            inputScheduler.terminateAndJoin();
+            flush();
+        }
+
+        /**
+         * @note Counted under the reorder window mutex, but readable at any time without it, e.g.: by a monitoring
+         * thread.
+         */
+        SequenceNumber fetchNumberOfOutOfOrderData() const noexcept {
+            return numberOfOutOfOrderData.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        void hold(T&& data) {
+            if (reorderWindow.size() == REORDER_WINDOW_SIZE) {
+                produceEarliestData();
+            }
+            auto acquisitionTime = acquisitionTimeOf(data);
+            reorderWindow.push_back({acquisitionTime, numberOfArrivedData++, std::move(data)});
+            std::push_heap(reorderWindow.begin(), reorderWindow.end(), std::greater<PendingData>());
+        }
+
+        void produceReleasedData(HighResolutionTimePoint const& now) {
+            while (!reorderWindow.empty() && now - reorderWindow.front().acquisitionTime >= latencyDeadline) {
+                produceEarliestData();
+            }
+        }
+
+        void produceEarliestData() {
+            std::pop_heap(reorderWindow.begin(), reorderWindow.end(), std::greater<PendingData>());
+            auto& earliestData = reorderWindow.back();
+            if (earliestData.acquisitionTime < lastProducedAcquisitionTime) {
+                numberOfOutOfOrderData.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                lastProducedAcquisitionTime = earliestData.acquisitionTime;
+            }
+            OutputSource::produce(std::move(earliestData.data));
+            reorderWindow.pop_back();
+        }
+
+        std::chrono::nanoseconds const latencyDeadline;
+
+        ACQUISITION_TIME acquisitionTimeOf;
+
+        Mutex reorderWindowMutex;
+
+        std::vector<PendingData> reorderWindow;
+
+        SequenceNumber numberOfArrivedData;
+
+        AtomicSequenceNumber numberOfOutOfOrderData;
+
+        HighResolutionTimePoint lastProducedAcquisitionTime;
+
+        InputScheduler inputScheduler;
+    };
+}
+
+#endif //SENSORGATEWAY_TIMESTAMPORDEREDMERGE_HPP
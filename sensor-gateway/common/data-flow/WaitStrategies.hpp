@@ -0,0 +1,124 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_WAITSTRATEGIES_HPP
+#define SENSORGATEWAY_WAITSTRATEGIES_HPP
+
+#include "sensor-gateway/common/TypeDefinition.h"
+
+namespace DataFlow {
+
+    /**
+     * @brief The wait strategies decide how a DataProcessingScheduler waits for one of its input buffers to be ready.
+     * waitUntil returns once the condition is met, signal is called every time the condition may have become true.
+     */
+
+    /**
+     * @brief Lowest latency, keeps its core busy while waiting.
+     */
+    class BusySpinWaitStrategy {
+
+    public:
+
+        template<class CONDITION>
+        void waitUntil(CONDITION&& condition) const {
+            while (!condition()) {}
+        }
+
+        void signal() const noexcept {}
+    };
+
+    /**
+     * @brief Spins for a while, then yields the core to the other threads between each check of the condition.
+     */
+    class SpinThenYieldWaitStrategy {
+
+        static uint16_t const NUMBER_OF_SPINS_BEFORE_YIELDING = 1000;
+
+    public:
+
+        template<class CONDITION>
+        void waitUntil(CONDITION&& condition) const {
+            auto numberOfSpins = 0u;
+            while (!condition()) {
+                if (numberOfSpins < NUMBER_OF_SPINS_BEFORE_YIELDING) {
+                    ++numberOfSpins;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void signal() const noexcept {}
+    };
+
+    /**
+     * @brief Sleeps on a condition variable until signaled, does not use any CPU while waiting.
+     */
+    class BlockingWaitStrategy {
+
+    public:
+
+        BlockingWaitStrategy() = default;
+
+        ~BlockingWaitStrategy() noexcept = default;
+
+        /**
+         * @warning The WaitStrategies are intended to be used as const instances. They shouldn't be moved.
+         */
+        BlockingWaitStrategy(BlockingWaitStrategy&& other) = delete;
+
+        /**
+         * @warning The WaitStrategies are intended to be used as const instances. They shouldn't be copied.
+         */
+        BlockingWaitStrategy(BlockingWaitStrategy const& other) = delete;
+
+        /**
+         * @warning The WaitStrategies are intended to be used as const instances. They shouldn't be assigned.
+         */
+        BlockingWaitStrategy& operator=(BlockingWaitStrategy const& other) = delete;
+
+        /**
+         * @warning The WaitStrategies are intended to be used as const instances. They shouldn't be assigned.
+         */
+        BlockingWaitStrategy& operator=(BlockingWaitStrategy&& other) = delete;
+
+        template<class CONDITION>
+        void waitUntil(CONDITION&& condition) {
+            UniqueLock lock(waitMutex);
+            conditionChanged.wait(lock, std::forward<CONDITION>(condition));
+        }
+
+        /**
+         * @note The mutex is taken before notifying so that a waiter cannot miss a change made right after it checked
+         * the condition.
+         */
+        void signal() {
+            {
+                LockGuard guard(waitMutex);
+            }
+            conditionChanged.notify_all();
+        }
+
+    private:
+
+        Mutex waitMutex;
+        ConditionVariable conditionChanged;
+    };
+}
+
+#endif //SENSORGATEWAY_WAITSTRATEGIES_HPP
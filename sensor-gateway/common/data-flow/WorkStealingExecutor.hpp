@@ -0,0 +1,219 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_WORKSTEALINGEXECUTOR_HPP
+#define SENSORGATEWAY_WORKSTEALINGEXECUTOR_HPP
+
+#include <deque>
+#include <vector>
+
+#include "sensor-gateway/common/TypeDefinition.h"
+
+namespace DataFlow {
+
+    class ExecutorTask {
+
+    protected:
+
+        ExecutorTask() = default;
+
+        virtual ~ExecutorTask() = default;
+
+    public:
+
+        virtual void execute() = 0;
+    };
+
+    /**
+     * @brief Fixed size pool of worker threads on which tasks, such as DataProcessingSchedulers, are executed.
+     * Each worker owns a queue and runs its tasks in scheduling order. A worker whose queue is empty steals the most
+     * recently scheduled task of another worker, and sleeps when there is no task left anywhere.
+     * @note A task scheduled from a worker goes to that worker's queue, others are spread over the queues.
+     */
+    class WorkStealingExecutor {
+
+        static size_t const NOT_A_WORKER = std::numeric_limits<size_t>::max();
+
+        struct WorkerQueue {
+            Mutex queueMutex;
+            std::deque<ExecutorTask*> tasks;
+        };
+
+        struct WorkerIdentity {
+            WorkStealingExecutor const* executor;
+            size_t queueIndex;
+        };
+
+    public:
+
+        explicit WorkStealingExecutor(size_t numberOfWorkers = fetchNumberOfCores()) :
+                terminateOrderReceived(false),
+                numberOfQueuedTasks(0),
+                nextQueueIndex(0),
+                queues(numberOfWorkers) {
+            for (auto queueIndex = 0u; queueIndex < numberOfWorkers; ++queueIndex) {
+                workers.emplace_back(&WorkStealingExecutor::work, this, queueIndex);
+            }
+        }
+
+        ~WorkStealingExecutor() noexcept {
+            terminateAndJoin();
+        }
+
+        /**
+         * @warning The WorkStealingExecutors are intended to be used as const instances. They shouldn't be moved.
+         */
+        WorkStealingExecutor(WorkStealingExecutor&& other) = delete;
+
+        /**
+         * @warning The WorkStealingExecutors are intended to be used as const instances. They shouldn't be copied.
+         */
+        WorkStealingExecutor(WorkStealingExecutor const& other) = delete;
+
+        /**
+         * @warning The WorkStealingExecutors are intended to be used as const instances. They shouldn't be assigned.
+         */
+        WorkStealingExecutor& operator=(WorkStealingExecutor const& other) = delete;
+
+        /**
+         * @warning The WorkStealingExecutors are intended to be used as const instances. They shouldn't be assigned.
+         */
+        WorkStealingExecutor& operator=(WorkStealingExecutor&& other) = delete;
+
+        /**
+         * @brief Executor shared by every SensorAccessLink of the process, with one worker per core.
+         */
+        static WorkStealingExecutor& shared() {
+            static WorkStealingExecutor sharedExecutor;
+            return sharedExecutor;
+        }
+
+        void schedule(ExecutorTask* task) {
+            auto queueIndex = fetchQueueIndexOfCurrentWorker();
+            if (queueIndex == NOT_A_WORKER) {
+                queueIndex = nextQueueIndex.fetch_add(1) % queues.size();
+            }
+            ++numberOfQueuedTasks;
+            {
+                LockGuard guard(queues[queueIndex].queueMutex);
+                queues[queueIndex].tasks.push_back(task);
+            }
+            {
+                LockGuard guard(sleepMutex);
+            }
+            taskScheduled.notify_one();
+        }
+
+        /**
+         * @note The tasks already scheduled are executed before the workers exit.
+         */
+        void terminateAndJoin() {
+            terminateOrderReceived.store(true);
+            {
+                LockGuard guard(sleepMutex);
+            }
+            taskScheduled.notify_all();
+            for (auto& worker : workers) {
+                worker.exitSafely();
+            }
+        }
+
+        size_t getNumberOfWorkers() const noexcept {
+            return queues.size();
+        }
+
+    private:
+
+        static size_t fetchNumberOfCores() noexcept {
+            return std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        static WorkerIdentity& currentWorkerIdentity() noexcept {
+            static thread_local WorkerIdentity workerIdentity = {nullptr, NOT_A_WORKER};
+            return workerIdentity;
+        }
+
+        size_t fetchQueueIndexOfCurrentWorker() const noexcept {
+            auto const& workerIdentity = currentWorkerIdentity();
+            if (workerIdentity.executor != this) {
+                return NOT_A_WORKER;
+            }
+            return workerIdentity.queueIndex;
+        }
+
+        void work(size_t queueIndex) {
+            currentWorkerIdentity() = {this, queueIndex};
+            while (true) {
+                auto task = takeTaskFor(queueIndex);
+                if (task != nullptr) {
+                    task->execute();
+                    continue;
+                }
+                UniqueLock lock(sleepMutex);
+                taskScheduled.wait(lock, [this]() {
+                    return numberOfQueuedTasks.load() != 0 || terminateOrderReceived.load();
+                });
+                if (numberOfQueuedTasks.load() == 0 && terminateOrderReceived.load()) {
+                    return;
+                }
+            }
+        }
+
+        ExecutorTask* takeTaskFor(size_t queueIndex) {
+            auto task = popOldestTaskOf(queues[queueIndex]);
+            for (auto offset = 1u; task == nullptr && offset < queues.size(); ++offset) {
+                task = stealNewestTaskOf(queues[(queueIndex + offset) % queues.size()]);
+            }
+            if (task != nullptr) {
+                --numberOfQueuedTasks;
+            }
+            return task;
+        }
+
+        ExecutorTask* popOldestTaskOf(WorkerQueue& queue) {
+            LockGuard guard(queue.queueMutex);
+            if (queue.tasks.empty()) {
+                return nullptr;
+            }
+            auto task = queue.tasks.front();
+            queue.tasks.pop_front();
+            return task;
+        }
+
+        ExecutorTask* stealNewestTaskOf(WorkerQueue& queue) {
+            LockGuard guard(queue.queueMutex);
+            if (queue.tasks.empty()) {
+                return nullptr;
+            }
+            auto task = queue.tasks.back();
+            queue.tasks.pop_back();
+            return task;
+        }
+
+        AtomicFlag terminateOrderReceived;
+        std::atomic<size_t> numberOfQueuedTasks;
+        std::atomic<size_t> nextQueueIndex;
+
+        std::vector<WorkerQueue> queues;
+        std::vector<JoinableThread> workers;
+
+        Mutex sleepMutex;
+        ConditionVariable taskScheduled;
+    };
+}
+
+#endif //SENSORGATEWAY_WORKSTEALINGEXECUTOR_HPP
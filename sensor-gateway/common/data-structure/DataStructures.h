@@ -18,17 +18,22 @@
 #define SENSORGATEWAY_DATASTRUCTURES_H
 
 #include "RawData.hpp"
+#include "NumericEncoding.hpp"
 
 namespace Sensor {
 
     /**
      * @brief This SensorMessageDefinition struct serves to declare types used by <SensorName>Message classes
      * @tparam P number of pixel for this sensor
+     * @tparam TrackEncodingPolicy NumericEncoding policy of the tracks in the compact representations of the messages
      */
-    template<std::size_t P, typename TimeTrackingDefinition>
+    template<std::size_t P, typename TimeTrackingDefinition,
+            typename TrackEncodingPolicy = DataFlow::NumericEncoding::DoublePrecision>
     struct SensorMessageDefinition {
         static std::size_t const NUMBER_OF_PIXELS = P;
 
+        using TrackEncoding = TrackEncodingPolicy;
+
         template<typename T>
         struct Pixels {
             using PixelType = T;
@@ -81,9 +86,17 @@ namespace Sensor {
     }
 
     namespace Communication {
+
+        /**
+         * @note The <SensorName>Structures classes can hide the RingBuffer capacities to size the buffers of their
+         * stages. The capacities MUST be powers of two.
+         */
         class DataStructures {
         public:
 
+            static size_t const MESSAGE_RING_BUFFER_SIZE = DataFlow::RING_BUFFER_SIZE;
+            static size_t const RAW_DATA_RING_BUFFER_SIZE = DataFlow::RING_BUFFER_SIZE;
+
             explicit DataStructures() = delete;
 
             ~DataStructures() noexcept = delete;
@@ -0,0 +1,147 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_NUMERICENCODING_HPP
+#define SENSORGATEWAY_NUMERICENCODING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "sensor-gateway/common/TypeDefinition.h"
+
+namespace DataFlow {
+
+    /**
+     * @brief Numeric policies deciding how the real values of the tracks are stored in their compact representations,
+     * e.g.: SparseFrame, SharedSensorMessage. Each policy gives the stored Value type and converts it from and to the
+     * double used by the gateway, so that the conversions only happen where a compact representation is built or read.
+     */
+    namespace NumericEncoding {
+
+        struct DoublePrecision {
+            using Value = double;
+
+            static inline Value encode(double value) noexcept {
+                return value;
+            }
+
+            static inline double decode(Value value) noexcept {
+                return value;
+            }
+        };
+
+        struct SinglePrecision {
+            using Value = float;
+
+            static inline Value encode(double value) noexcept {
+                return static_cast<Value>(value);
+            }
+
+            static inline double decode(Value value) noexcept {
+                return value;
+            }
+        };
+
+        /**
+         * @brief Stores round(value * SCALE) in an INTEGER, saturated to its limits.
+         * @tparam SCALE number of stored units per gateway unit, e.g.: 100 stores meters as centimeters
+         */
+        template<class INTEGER, int32_t SCALE>
+        struct FixedPoint {
+            static_assert(std::is_integral<INTEGER>::value, "The FixedPoint values must be stored in an integer");
+            static_assert(SCALE > 0, "The FixedPoint SCALE must be positive");
+
+            using Value = INTEGER;
+
+            static inline Value encode(double value) noexcept {
+                auto scaledValue = std::round(value * SCALE);
+                scaledValue = std::max<double>(scaledValue, std::numeric_limits<Value>::min());
+                scaledValue = std::min<double>(scaledValue, std::numeric_limits<Value>::max());
+                return static_cast<Value>(scaledValue);
+            }
+
+            static inline double decode(Value value) noexcept {
+                return static_cast<double>(value) / SCALE;
+            }
+        };
+
+        /**
+         * @note Range of +/-327.67, i.e.: a signed centimeter count of the AWL once translated to meters.
+         */
+        using Centi16 = FixedPoint<int16_t, 100>;
+
+        /**
+         * @note Range of [0, 655.35], i.e.: an unsigned centimeter count of the AWL once translated to meters.
+         */
+        using UnsignedCenti16 = FixedPoint<uint16_t, 100>;
+
+        /**
+         * @note Holds a signed raw 16 bits sensor value as is.
+         */
+        using Unit16 = FixedPoint<int16_t, 1>;
+
+        /**
+         * @note Holds an unsigned raw 16 bits sensor value as is.
+         */
+        using UnsignedUnit16 = FixedPoint<uint16_t, 1>;
+
+        using Milli32 = FixedPoint<int32_t, 1000>;
+
+        /**
+         * @brief Track encoding policy giving each real value of the tracks its own encoding, so that each one keeps
+         * the range of the sensor value it comes from.
+         */
+        template<class INTENSITY, class ACCELERATION, class DISTANCE, class SPEED>
+        struct PerTrackField {
+        };
+
+        /**
+         * @brief Encoding of each real value of the tracks. A single encoding policy applies to every value.
+         */
+        template<class ENCODING>
+        struct TrackFieldEncodings {
+            using Intensity = ENCODING;
+            using Acceleration = ENCODING;
+            using Distance = ENCODING;
+            using Speed = ENCODING;
+        };
+
+        template<class INTENSITY, class ACCELERATION, class DISTANCE, class SPEED>
+        struct TrackFieldEncodings<PerTrackField<INTENSITY, ACCELERATION, DISTANCE, SPEED>> {
+            using Intensity = INTENSITY;
+            using Acceleration = ACCELERATION;
+            using Distance = DISTANCE;
+            using Speed = SPEED;
+        };
+
+        /**
+         * @note The AWL translation gives its intensities as a signal to noise ratio, and its distances, speeds and
+         * accelerations in meters from the centimeters of the sensor, see AWLTranslationStrategy.
+         */
+        using AWLTrackEncoding = PerTrackField<Centi16, Centi16, UnsignedCenti16, Centi16>;
+
+        /**
+         * @note The Guardian translation keeps the raw values of the sensor, unsigned intensities and distances, signed
+         * speeds and accelerations, see GuardianTranslationStrategy.
+         */
+        using GuardianTrackEncoding = PerTrackField<UnsignedUnit16, Unit16, UnsignedUnit16, Unit16>;
+    }
+}
+
+#endif //SENSORGATEWAY_NUMERICENCODING_HPP
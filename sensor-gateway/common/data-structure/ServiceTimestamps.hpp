@@ -17,6 +17,8 @@
 #ifndef SENSORGATEWAY_SERVICETIMESTAMPS_HPP
 #define SENSORGATEWAY_SERVICETIMESTAMPS_HPP
 
+#include <type_traits>
+
 #include "sensor-gateway/common/error/SensorAccessLinkError.h"
 #include "TimePoint.h"
 
@@ -45,25 +47,13 @@ namespace Metrics {
 
         ~ServiceTimestamps() noexcept = default;
 
-        ServiceTimestamps(ServiceTimestamps const& other) :
-                timePoints(other.timePoints),
-                currentNumberOfTimePoints(other.currentNumberOfTimePoints) {}
+        ServiceTimestamps(ServiceTimestamps const& other) = default;
 
-        ServiceTimestamps(ServiceTimestamps&& other) noexcept :
-                timePoints(std::move(timePoints)),
-                currentNumberOfTimePoints(std::move(other.currentNumberOfTimePoints)) {
-        }
+        ServiceTimestamps(ServiceTimestamps&& other) noexcept = default;
 
-        ServiceTimestamps& operator=(ServiceTimestamps const& other)& {
-            ServiceTimestamps temporary(other);
-            swap(*this, temporary);
-            return *this;
-        }
+        ServiceTimestamps& operator=(ServiceTimestamps const& other)& = default;
 
-        ServiceTimestamps& operator=(ServiceTimestamps&& other)& noexcept {
-            swap(*this, other);
-            return *this;
-        }
+        ServiceTimestamps& operator=(ServiceTimestamps&& other)& noexcept = default;
 
         static void swap(ServiceTimestamps& current, ServiceTimestamps& other) noexcept {
             std::swap(current.timePoints, other.timePoints);
@@ -86,10 +76,10 @@ namespace Metrics {
 
         static ServiceTimestamps const& returnDefaultData() noexcept;
 
-        void addTimePointForLocation(std::string const& locationName) {
+        void addTimePointForLocation(LocationId const& location) {
             validateNotFull();
             timePoints[currentNumberOfTimePoints].timestamp = HighResolutionClock::now();
-            timePoints[currentNumberOfTimePoints].location = locationName;
+            timePoints[currentNumberOfTimePoints].location = location;
             ++currentNumberOfTimePoints;
         }
 
@@ -121,6 +111,9 @@ namespace Metrics {
         TimePoints timePoints;
     };
 
+    static_assert(std::is_trivially_copyable<ServiceTimestamps<1>>::value,
+                  "The ServiceTimestamps are carried by the messages, they must be copied without allocating");
+
     namespace Defaults {
         using Metrics::ServiceTimestamps;
 
@@ -22,32 +22,12 @@
 using Metrics::TimePoint;
 
 TimePoint::TimePoint(HighResolutionTimePoint const& timestamp,
-                     std::string location) :
+                     LocationId const& location) :
         timestamp(timestamp),
-        location(std::move(location)) {}
+        location(location) {}
 
 TimePoint::TimePoint() : TimePoint(returnDefaultData()) {}
 
-TimePoint::TimePoint(TimePoint const& other) :
-        timestamp(other.timestamp),
-        location(other.location) {}
-
-TimePoint::TimePoint(TimePoint&& other) noexcept :
-        timestamp(std::move(other.timestamp)),
-        location(std::move(other.location)) {
-}
-
-TimePoint& TimePoint::operator=(TimePoint const& other)& {
-    TimePoint temporary(other);
-    swap(*this, temporary);
-    return *this;
-}
-
-TimePoint& TimePoint::operator=(TimePoint&& other)& noexcept {
-    swap(*this, other);
-    return *this;
-}
-
 void TimePoint::swap(TimePoint& current, TimePoint& other) noexcept {
     std::swap(current.timestamp, other.timestamp);
     std::swap(current.location, other.location);
@@ -69,4 +49,8 @@ TimePoint const& TimePoint::returnDefaultData() noexcept {
     return Defaults::DEFAULT_TIME_POINT;
 }
 
+std::string const& TimePoint::fetchLocationName() const noexcept {
+    return LocationNames::nameOf(location);
+}
+
 #endif //SENSORGATEWAY_TIMEPOINTS_CPP
@@ -25,19 +25,19 @@ namespace Metrics {
 
     public:
 
-        explicit TimePoint(HighResolutionTimePoint const& timestamp, std::string location);
+        explicit TimePoint(HighResolutionTimePoint const& timestamp, LocationId const& location);
 
         explicit TimePoint();
 
         ~TimePoint() noexcept = default;
 
-        TimePoint(TimePoint const& other);
+        TimePoint(TimePoint const& other) = default;
 
-        TimePoint(TimePoint&& other) noexcept;
+        TimePoint(TimePoint&& other) noexcept = default;
 
-        TimePoint& operator=(TimePoint const& other)&;
+        TimePoint& operator=(TimePoint const& other)& = default;
 
-        TimePoint& operator=(TimePoint&& other)& noexcept;
+        TimePoint& operator=(TimePoint&& other)& noexcept = default;
 
         void swap(TimePoint& current, TimePoint& other) noexcept;
 
@@ -47,8 +47,10 @@ namespace Metrics {
 
         static TimePoint const& returnDefaultData() noexcept;
 
+        std::string const& fetchLocationName() const noexcept;
+
         HighResolutionTimePoint timestamp;
-        std::string location;
+        LocationId location;
 
     };
 
@@ -57,9 +59,9 @@ namespace Metrics {
 
         HighResolutionTimePoint const DEFAULT_TIMESTAMP = BEGINNING_OF_TIME_ITSELF;
 
-        std::string const DEFAULT_LOCATION_NAME;
+        LocationId const DEFAULT_LOCATION = Locations::UNSPECIFIED;
 
-        TimePoint const DEFAULT_TIME_POINT = TimePoint(DEFAULT_TIMESTAMP, DEFAULT_LOCATION_NAME);
+        TimePoint const DEFAULT_TIME_POINT = TimePoint(DEFAULT_TIMESTAMP, DEFAULT_LOCATION);
     }
 
 }
@@ -38,6 +38,7 @@ namespace Metrics {
     // TODO: For eventual debug/prod compilation, see https://en.cppreference.com/w/cpp/types/conditional
     /**
      * @warning This class is NOT thread-safe!
+     * @note This class is trivially copyable, a message carrying it can be copied without allocating.
      */
     template<typename TimeTrackingDefinition>
     class TimeTracking {
@@ -57,27 +58,17 @@ namespace Metrics {
 
         ~TimeTracking() noexcept = default;
 
-        TimeTracking(TimeTracking const& other) :
-                TimeTracking(other.sensorTimestamps, other.gatewayTimestamps) {}
+        TimeTracking(TimeTracking const& other) = default;
 
-        TimeTracking(TimeTracking&& other) noexcept :
-                sensorTimestamps(std::move(sensorTimestamps)),
-                gatewayTimestamps(std::move(gatewayTimestamps)) {
-        }
+        TimeTracking(TimeTracking&& other) noexcept = default;
 
-        TimeTracking& operator=(TimeTracking const& other)& {
-            TimeTracking temporary(other);
-            swap(*this, temporary);
-            return *this;
-        }
+        TimeTracking& operator=(TimeTracking const& other)& = default;
 
-        TimeTracking& operator=(TimeTracking&& other)& noexcept {
-            swap(*this, other);
-            return *this;
-        }
+        TimeTracking& operator=(TimeTracking&& other)& noexcept = default;
 
         void swap(TimeTracking& current, TimeTracking& other) noexcept {
-            std::swap(current.content, other.content);
+            SensorTimestamps::swap(current.sensorTimestamps, other.sensorTimestamps);
+            GatewayTimestamps::swap(current.gatewayTimestamps, other.gatewayTimestamps);
         }
 
         bool operator==(TimeTracking const& other) const {
@@ -94,12 +85,12 @@ namespace Metrics {
 
         static TimeTracking const& returnDefaultData() noexcept;
 
-        void addTimePointForSensorWithLocation(std::string const& locationName) {
-            sensorTimestamps.addTimePointForLocation(locationName);
+        void addTimePointForSensorWithLocation(LocationId const& location) {
+            sensorTimestamps.addTimePointForLocation(location);
         }
 
-        void addTimePointForGatewayWithLocation(std::string const& locationName) {
-            gatewayTimestamps.addTimePointForLocation(locationName);
+        void addTimePointForGatewayWithLocation(LocationId const& location) {
+            gatewayTimestamps.addTimePointForLocation(location);
         }
 
         SensorTimestamps const& getSensorTimestamps() noexcept {
@@ -116,6 +107,9 @@ namespace Metrics {
         GatewayTimestamps gatewayTimestamps;
     };
 
+    static_assert(std::is_trivially_copyable<TimeTracking<TimeTrackingDefinition<1, 1>>>::value,
+                  "The TimeTracking is carried by the messages, it must be copied without allocating");
+
     namespace Defaults {
         using Metrics::TimeTracking;
 
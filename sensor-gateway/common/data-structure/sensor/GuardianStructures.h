@@ -59,6 +59,10 @@ namespace Sensor {
             static size_t const MAX_NUMBER_OF_BULK_FETCHABLE_MESSAGES = 32;
             static size_t const MAX_NUMBER_OF_BULK_FETCHABLE_RAW_DATA_CYCLES = 8;
 
+            // 4 bulk fetches of messages, the raw data ring is kept as deep so that it never drops before it
+            static size_t const MESSAGE_RING_BUFFER_SIZE = 128;
+            static size_t const RAW_DATA_RING_BUFFER_SIZE = MESSAGE_RING_BUFFER_SIZE;
+
             static std::array<RawDataTypes::GUARDIAN,
                     Guardian::NUMBER_OF_CHANNELS> constexpr CHANNEL_POSITIONS = {
                     8, 0, 9, 1, 10, 2, 11, 3, 12, 4, 13, 5, 14, 6, 15, 7
@@ -0,0 +1,72 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_ENCODEDTRACK_HPP
+#define SENSORGATEWAY_ENCODEDTRACK_HPP
+
+#include "sensor-gateway/common/data-structure/NumericEncoding.hpp"
+#include "Track.h"
+
+namespace DataFlow {
+
+    /**
+     * @brief Compact, trivially copyable, image of a Track whose real values are stored as given by a NumericEncoding
+     * policy, either a single one or one per value, e.g.: 12 bytes instead of 48 with NumericEncoding::AWLTrackEncoding.
+     * The real values come first so that, as long as they share a size, no padding is added between them.
+     */
+    template<class ENCODING>
+    struct EncodedTrack {
+
+        using FieldEncodings = NumericEncoding::TrackFieldEncodings<ENCODING>;
+        using IntensityEncoding = typename FieldEncodings::Intensity;
+        using AccelerationEncoding = typename FieldEncodings::Acceleration;
+        using DistanceEncoding = typename FieldEncodings::Distance;
+        using SpeedEncoding = typename FieldEncodings::Speed;
+
+        static EncodedTrack encode(Track const& track) noexcept {
+            return EncodedTrack{IntensityEncoding::encode(track.intensity),
+                                AccelerationEncoding::encode(track.acceleration),
+                                DistanceEncoding::encode(track.distance),
+                                SpeedEncoding::encode(track.speed),
+                                track.id, track.confidenceLevel};
+        }
+
+        Track decode() const {
+            return Track(id, confidenceLevel, IntensityEncoding::decode(intensity),
+                         AccelerationEncoding::decode(acceleration), DistanceEncoding::decode(distance),
+                         SpeedEncoding::decode(speed));
+        }
+
+        bool operator==(EncodedTrack const& other) const noexcept {
+            return id == other.id && confidenceLevel == other.confidenceLevel && intensity == other.intensity &&
+                   acceleration == other.acceleration && distance == other.distance && speed == other.speed;
+        }
+
+        bool operator!=(EncodedTrack const& other) const noexcept {
+            return !(operator==(other));
+        }
+
+        typename IntensityEncoding::Value intensity;
+        typename AccelerationEncoding::Value acceleration;
+        typename DistanceEncoding::Value distance;
+        typename SpeedEncoding::Value speed;
+        TrackId id;
+        ConfidenceLevel confidenceLevel;
+    };
+}
+
+#endif //SENSORGATEWAY_ENCODEDTRACK_HPP
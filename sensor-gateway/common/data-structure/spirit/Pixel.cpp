@@ -45,9 +45,17 @@ Pixel::Pixel(Pixel&& other) noexcept: id(other.id),
 
 };
 
+/**
+ * @note Only the populated tracks of the other pixel are copied, the tracks this pixel no longer populates are reset to
+ * the default track.
+ */
 Pixel& Pixel::operator=(Pixel const& other)& {
-    Pixel temporary(other);
-    swap(*this, temporary);
+    id = other.id;
+    std::copy(other.tracks.begin(), other.tracks.begin() + other.currentNumberOfTracksInPixel, tracks.begin());
+    for (auto trackIndex = other.currentNumberOfTracksInPixel; trackIndex < currentNumberOfTracksInPixel; ++trackIndex) {
+        tracks[trackIndex] = Track::returnDefaultData();
+    }
+    currentNumberOfTracksInPixel = other.currentNumberOfTracksInPixel;
     return *this;
 };
 
@@ -64,8 +72,9 @@ void Pixel::swap(Pixel& current, Pixel& other) noexcept {
 
 bool Pixel::operator==(Pixel const& other) const {
     auto samePixelId = (id == other.id);
-    auto sameTracks = (tracks == other.tracks);
     auto sameCurrentNumberOfTracks = (currentNumberOfTracksInPixel == other.currentNumberOfTracksInPixel);
+    auto sameTracks = sameCurrentNumberOfTracks &&
+                      std::equal(tracks.begin(), tracks.begin() + currentNumberOfTracksInPixel, other.tracks.begin());
     auto pixelsAreEqual = (samePixelId && sameTracks && sameCurrentNumberOfTracks);
     return pixelsAreEqual;
 }
@@ -81,13 +90,12 @@ void Pixel::addTrack(Track&& track) {
 }
 
 bool Pixel::doesTrackExist(TrackId const& trackId) {
-    bool trackExists = false;
-    for (auto track:*getTracks()) {
+    for (auto const& track : tracks) {
         if (track.id == trackId) {
-            trackExists = true;
+            return true;
         }
     }
-    return trackExists;
+    return false;
 };
 
 Track* Pixel::fetchTrackById(TrackId const& trackId) {
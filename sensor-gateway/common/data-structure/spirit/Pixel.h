@@ -48,6 +48,10 @@ namespace DataFlow {
 
         static void swap(Pixel& current, Pixel& other) noexcept;
 
+        /**
+         * @note Only the populated tracks are compared: two pixels that only differ past their current number of
+         * tracks are equal.
+         */
         bool operator==(Pixel const& other) const;
 
         bool operator!=(Pixel const& other) const;
@@ -60,6 +64,16 @@ namespace DataFlow {
 
         TracksArray* getTracks();
 
+        /**
+         * @brief Walks the populated tracks only, in the order they were added.
+         */
+        template<class VISITOR>
+        void forEachTrack(VISITOR&& visitor) const {
+            for (auto trackIndex = 0; trackIndex < currentNumberOfTracksInPixel; ++trackIndex) {
+                visitor(tracks[trackIndex]);
+            }
+        }
+
         static Pixel const& returnDefaultData() noexcept;
 
         PixelId id;
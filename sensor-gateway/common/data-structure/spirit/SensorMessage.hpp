@@ -17,10 +17,17 @@
 #ifndef SENSORGATEWAY_SENSORMESSAGE_HPP
 #define SENSORGATEWAY_SENSORMESSAGE_HPP
 
-#include "Pixel.h"
+#include "SparseFrame.hpp"
+#include "sensor-gateway/common/container/BlockPool.hpp"
 
 namespace DataFlow {
 
+    /**
+     * @brief The pixels are held in a block of the shared pool of their type, uniquely owned by the message, so that a
+     * move only steals the block and the payload is never copied on its way from the translation to the server.
+     * @note A message moved from by construction has no block, it reads as holding the default pixels until they are
+     * modified. A message moved from by assignment holds the previous block of its target instead.
+     */
     template<typename SensorMessageDefinition>
     class SensorMessage : public SensorMessageDefinition::TimeTracking {
 
@@ -32,24 +39,52 @@ namespace DataFlow {
 
         using Pixels = typename SensorMessageDefinition::template Pixels<Pixel>::type;
 
-        explicit SensorMessage(MessageId messageId, SensorId sensorId, Pixels pixels) :
-                messageId(messageId), sensorId(sensorId), pixels(std::move(pixels)) {};
+        using PixelsPool = Container::BlockPool<Pixels>;
+
+        using TrackEncoding = typename SensorMessageDefinition::TrackEncoding;
+
+        using Frame = SparseFrame<SensorMessageDefinition::NUMBER_OF_PIXELS, TrackEncoding>;
+
+        explicit SensorMessage(MessageId messageId, SensorId sensorId, Pixels const& pixelsToHold) :
+                messageId(messageId), sensorId(sensorId), pixels(PixelsPool::shared().acquireCopyOf(pixelsToHold)) {};
+
+        explicit SensorMessage(MessageId messageId, SensorId sensorId, Frame const& frame);
 
         SensorMessage() : SensorMessage(returnDefaultData()) {};
 
         ~SensorMessage() = default;
 
+        /**
+         * @note A message without a block is copied without one, so that copying a moved from message acquires none.
+         */
         SensorMessage(SensorMessage const& other) :
-                SensorMessage(other.messageId, other.sensorId, other.pixels) {};
+                superTimeTracking(other),
+                messageId(other.messageId),
+                sensorId(other.sensorId),
+                pixels(other.pixels ? PixelsPool::shared().acquireCopyOf(*other.pixels)
+                                    : typename PixelsPool::Block()) {};
 
         SensorMessage(SensorMessage&& other) noexcept;
 
+        /**
+         * @note The pixels are copied in the block already held, if any, so that no block is acquired.
+         */
         SensorMessage& operator=(SensorMessage const& other)& {
-            SensorMessage temporary(other);
-            swap(*this, temporary);
+            superTimeTracking::operator=(other);
+            messageId = other.messageId;
+            sensorId = other.sensorId;
+            if (pixels) {
+                *pixels = other.readPixels();
+            } else {
+                pixels = PixelsPool::shared().acquireCopyOf(other.readPixels());
+            }
             return *this;
         };
 
+        /**
+         * @note The messages are swapped: the moved from message keeps the block this one held, if any, instead of
+         * releasing it to the pool, so that the block is reused by whatever is next written in that message.
+         */
         SensorMessage& operator=(SensorMessage&& other)& noexcept {
             swap(*this, other);
             return *this;
@@ -60,7 +95,7 @@ namespace DataFlow {
         bool operator==(SensorMessage const& other) const {
             auto sameSensorMessageId = (messageId == other.messageId);
             auto sameSensorId = (sensorId == other.sensorId);
-            auto samePixels = (pixels == other.pixels);
+            auto samePixels = (readPixels() == other.readPixels());
             auto sensorMessagesAreEqual = (sameSensorMessageId && sameSensorId && samePixels);
             return sensorMessagesAreEqual;
         }
@@ -73,7 +108,7 @@ namespace DataFlow {
 
         void addTrackToPixelWithId(PixelId const& pixelId, Track&& trackToAdd) {
             updatePixelId(pixelId);
-            pixels[pixelId].addTrack(std::forward<Track>(trackToAdd));
+            (*holdPixels())[pixelId].addTrack(std::forward<Track>(trackToAdd));
         }
 
         std::string const getSensorIdentifier() const noexcept {
@@ -83,8 +118,34 @@ namespace DataFlow {
             return sensorIdentifier;
         }
 
-        Pixels* getPixels() {
-            return &pixels;
+        /**
+         * @note Never acquires a block: a message without one reads as the default pixels.
+         */
+        Pixels const& readPixels() const noexcept;
+
+        /**
+         * @brief Gives the pixels to modify them in place.
+         * @note Acquires a block, initialised with the default pixels, if the message has none.
+         */
+        Pixels* holdPixels();
+
+        /**
+         * @brief Writes the pixels in the given frame, only the populated tracks are copied.
+         */
+        void compactInto(Frame& frame) const {
+            frame.assign(readPixels());
+        }
+
+        /**
+         * @param visitor called with the id of the pixel and each of its populated tracks, in pixel order
+         */
+        template<class VISITOR>
+        void forEachTrack(VISITOR&& visitor) const {
+            for (auto const& pixel : readPixels()) {
+                pixel.forEachTrack([&visitor, &pixel](Track const& track) {
+                    visitor(pixel.id, track);
+                });
+            }
         }
 
         using superTimeTracking::addTimePointForSensorWithLocation;
@@ -97,10 +158,10 @@ namespace DataFlow {
 
     private:
 
-        Pixels pixels;
+        typename PixelsPool::Block pixels;
 
         void updatePixelId(PixelId const& pixelId) {
-            pixels[pixelId].id = pixelId;
+            (*holdPixels())[pixelId].id = pixelId;
         }
     };
 
@@ -128,14 +189,34 @@ namespace DataFlow {
 
     template<typename SensorMessageDefinition>
     SensorMessage<SensorMessageDefinition>::SensorMessage(SensorMessage<SensorMessageDefinition>&& other) noexcept:
+            superTimeTracking(std::move(other)),
             messageId(other.messageId),
             sensorId(other.sensorId),
-            pixels(other.pixels) {
+            pixels(std::move(other.pixels)) {
         other.messageId = Defaults::DEFAULT_MESSAGE_ID;
         other.sensorId = Defaults::DEFAULT_SENSOR_ID;
-        other.pixels = Defaults::DEFAULT_PIXELS_ARRAY<SensorMessageDefinition>;
     };
 
+    template<typename SensorMessageDefinition>
+    SensorMessage<SensorMessageDefinition>::SensorMessage(MessageId messageId, SensorId sensorId, Frame const& frame) :
+            SensorMessage(messageId, sensorId, Defaults::DEFAULT_PIXELS_ARRAY<SensorMessageDefinition>) {
+        frame.expandInto(*pixels);
+    };
+
+    template<typename SensorMessageDefinition>
+    typename SensorMessage<SensorMessageDefinition>::Pixels const&
+    SensorMessage<SensorMessageDefinition>::readPixels() const noexcept {
+        return pixels ? *pixels : Defaults::DEFAULT_PIXELS_ARRAY<SensorMessageDefinition>;
+    }
+
+    template<typename SensorMessageDefinition>
+    typename SensorMessage<SensorMessageDefinition>::Pixels* SensorMessage<SensorMessageDefinition>::holdPixels() {
+        if (!pixels) {
+            pixels = PixelsPool::shared().acquireCopyOf(Defaults::DEFAULT_PIXELS_ARRAY<SensorMessageDefinition>);
+        }
+        return pixels.get();
+    }
+
 
     template<typename SensorMessageDefinition>
     SensorMessage<SensorMessageDefinition> const& SensorMessage<SensorMessageDefinition>::returnDefaultData() noexcept {
@@ -145,6 +226,7 @@ namespace DataFlow {
     template<typename SensorMessageDefinition>
     void SensorMessage<SensorMessageDefinition>::swap(SensorMessage<SensorMessageDefinition>& current,
                                                       SensorMessage<SensorMessageDefinition>& other) noexcept {
+        current.superTimeTracking::swap(current, other);
         std::swap(current.messageId, other.messageId);
         std::swap(current.sensorId, other.sensorId);
         std::swap(current.pixels, other.pixels);
@@ -0,0 +1,80 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_SHAREDMEMORYSLOTS_HPP
+#define SENSORGATEWAY_SHAREDMEMORYSLOTS_HPP
+
+#include "SensorMessage.hpp"
+#include "EncodedTrack.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief Flat, trivially copyable, image of a SensorMessage, as written in a SharedMemoryRingBuffer slot.
+     * The time tracking is not shared: it only makes sense inside the gateway. The tracks are shared as encoded by the
+     * TrackEncoding of the message.
+     */
+    template<class MESSAGE>
+    struct SharedSensorMessage {
+
+        static size_t const NUMBER_OF_PIXELS = std::tuple_size<typename MESSAGE::Pixels>::value;
+
+        using SharedTrack = EncodedTrack<typename MESSAGE::TrackEncoding>;
+
+        struct SharedPixel {
+            PixelId id;
+            uint16_t numberOfTracks;
+            SharedTrack tracks[NUMBER_OF_TRACKS_IN_PIXEL];
+        };
+
+        MessageId messageId;
+        SensorId sensorId;
+        SharedPixel pixels[NUMBER_OF_PIXELS];
+
+        void copyFrom(MESSAGE const& message) noexcept {
+            messageId = message.messageId;
+            sensorId = message.sensorId;
+            auto const& messagePixels = message.readPixels();
+            for (auto pixelIndex = 0u; pixelIndex < NUMBER_OF_PIXELS; ++pixelIndex) {
+                auto const& messagePixel = messagePixels[pixelIndex];
+                auto& pixel = pixels[pixelIndex];
+                pixel.id = messagePixel.id;
+                pixel.numberOfTracks = 0;
+                messagePixel.forEachTrack([&pixel](Track const& track) {
+                    pixel.tracks[pixel.numberOfTracks++] = SharedTrack::encode(track);
+                });
+            }
+        }
+    };
+
+    /**
+     * @brief Flat image of a RawData, as written in a SharedMemoryRingBuffer slot.
+     */
+    template<class RAW_DATA>
+    struct SharedRawData {
+
+        static_assert(std::is_trivially_copyable<typename RAW_DATA::Content>::value,
+                      "The RawData content must be trivially copyable to be shared with other processes");
+
+        typename RAW_DATA::Content content;
+
+        void copyFrom(RAW_DATA const& rawData) noexcept {
+            content = rawData.content;
+        }
+    };
+}
+
+#endif //SENSORGATEWAY_SHAREDMEMORYSLOTS_HPP
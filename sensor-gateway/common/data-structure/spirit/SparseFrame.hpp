@@ -0,0 +1,142 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_SPARSEFRAME_HPP
+#define SENSORGATEWAY_SPARSEFRAME_HPP
+
+#include <vector>
+
+#include "Pixel.h"
+#include "EncodedTrack.hpp"
+
+namespace DataFlow {
+
+    /**
+     * @brief Compact image of the pixels of a SensorMessage, sized by its actual number of tracks.
+     * The populated tracks of every pixel are held contiguously in a single vector, in pixel order, and the tracks of a
+     * pixel are found with the offsets of the pixels in that vector (compressed sparse row layout). Building, comparing
+     * and walking a frame only ever touch its populated tracks. The tracks are stored as EncodedTracks, they are only
+     * converted when the frame is built or read.
+     * @note The track vector keeps its capacity when the frame is assigned again, so that a reused frame does not
+     * allocate once it held a frame with as many tracks.
+     * @note The translation and server path still carry the full pixels of the SensorMessages. A frame is only built
+     * on demand, with SensorMessage::compactInto, by the consumers that store or compare the messages.
+     */
+    template<size_t NUMBER_OF_PIXELS, class TRACK_ENCODING = NumericEncoding::DoublePrecision>
+    class SparseFrame {
+
+        using Offset = uint16_t;
+
+    public:
+
+        using StoredTrack = EncodedTrack<TRACK_ENCODING>;
+
+        SparseFrame() {
+            pixelIds.fill(::Defaults::Pixel::DEFAULT_ID);
+            pixelOffsets.fill(0);
+        }
+
+        template<class PIXELS>
+        explicit SparseFrame(PIXELS const& pixels) : SparseFrame() {
+            assign(pixels);
+        }
+
+        ~SparseFrame() noexcept = default;
+
+        SparseFrame(SparseFrame const& other) = default;
+
+        SparseFrame(SparseFrame&& other) noexcept = default;
+
+        SparseFrame& operator=(SparseFrame const& other)& = default;
+
+        SparseFrame& operator=(SparseFrame&& other)& noexcept = default;
+
+        template<class PIXELS>
+        void assign(PIXELS const& pixels) {
+            static_assert(std::tuple_size<PIXELS>::value == NUMBER_OF_PIXELS,
+                          "The SparseFrame must have as many pixels as the frame it is built from");
+            tracks.clear();
+            for (auto pixelIndex = 0u; pixelIndex < NUMBER_OF_PIXELS; ++pixelIndex) {
+                auto const& pixel = pixels[pixelIndex];
+                pixelIds[pixelIndex] = pixel.id;
+                pixelOffsets[pixelIndex] = static_cast<Offset>(tracks.size());
+                pixel.forEachTrack([this](Track const& track) {
+                    tracks.push_back(StoredTrack::encode(track));
+                });
+            }
+            pixelOffsets[NUMBER_OF_PIXELS] = static_cast<Offset>(tracks.size());
+        }
+
+        /**
+         * @brief Writes the frame back into dense pixels, the tracks that are not populated are left to the default.
+         */
+        template<class PIXELS>
+        void expandInto(PIXELS& pixels) const {
+            for (auto pixelIndex = 0u; pixelIndex < NUMBER_OF_PIXELS; ++pixelIndex) {
+                TracksArray pixelTracks;
+                auto storedTracks = tracksOf(pixelIndex);
+                for (auto trackIndex = 0u; trackIndex < numberOfTracksIn(pixelIndex); ++trackIndex) {
+                    pixelTracks[trackIndex] = storedTracks[trackIndex].decode();
+                }
+                pixels[pixelIndex] = Pixel(pixelIds[pixelIndex], pixelTracks, numberOfTracksIn(pixelIndex));
+            }
+        }
+
+        /**
+         * @param visitor called with the id of the pixel and each of its populated tracks, decoded, in pixel order
+         */
+        template<class VISITOR>
+        void forEachTrack(VISITOR&& visitor) const {
+            for (auto pixelIndex = 0u; pixelIndex < NUMBER_OF_PIXELS; ++pixelIndex) {
+                auto pixelTracks = tracksOf(pixelIndex);
+                for (auto trackIndex = 0u; trackIndex < numberOfTracksIn(pixelIndex); ++trackIndex) {
+                    visitor(pixelIds[pixelIndex], pixelTracks[trackIndex].decode());
+                }
+            }
+        }
+
+        StoredTrack const* tracksOf(size_t pixelIndex) const noexcept {
+            return tracks.data() + pixelOffsets[pixelIndex];
+        }
+
+        Offset numberOfTracksIn(size_t pixelIndex) const noexcept {
+            return pixelOffsets[pixelIndex + 1] - pixelOffsets[pixelIndex];
+        }
+
+        size_t numberOfTracks() const noexcept {
+            return tracks.size();
+        }
+
+        bool operator==(SparseFrame const& other) const {
+            return pixelIds == other.pixelIds && pixelOffsets == other.pixelOffsets && tracks == other.tracks;
+        }
+
+        bool operator!=(SparseFrame const& other) const {
+            return !(operator==(other));
+        }
+
+    private:
+
+        std::array<PixelId, NUMBER_OF_PIXELS> pixelIds;
+
+        std::array<Offset, NUMBER_OF_PIXELS + 1> pixelOffsets;
+
+        std::vector<StoredTrack> tracks;
+    };
+}
+
+#endif //SENSORGATEWAY_SPARSEFRAME_HPP
@@ -23,7 +23,12 @@
 namespace Sensor {
     namespace Spirit {
 
-        template<typename SensorMessageDefinition, typename RawDataDefinition, typename CommandDefinition>
+        /**
+         * @tparam TrackEncoding NumericEncoding policy of the tracks in the compact representations of the messages,
+         * e.g.: NumericEncoding::AWLTrackEncoding to share or store the AWL tracks in 12 bytes
+         */
+        template<typename SensorMessageDefinition, typename RawDataDefinition, typename CommandDefinition,
+                typename TrackEncoding = DataFlow::NumericEncoding::DoublePrecision>
         class Structures final : public Communication::DataStructures {
 
         protected:
@@ -44,7 +49,8 @@ namespace Sensor {
             typedef typename
             Sensor::SensorMessageDefinition<
                     SensorMessageDefinition::NUMBER_OF_PIXELS,
-                    GatewayTimeTrackingDefinition
+                    GatewayTimeTrackingDefinition,
+                    TrackEncoding
             > GatewaySensorMessageDefinition;
 
             enum DataType : uint32_t {
@@ -63,6 +69,10 @@ namespace Sensor {
 
             static size_t const MAX_NUMBER_OF_BULK_FETCHABLE_MESSAGES = 32;
             static size_t const MAX_NUMBER_OF_BULK_FETCHABLE_RAW_DATA_CYCLES = 8;
+
+            // 4 bulk fetches of messages, the raw data ring is kept as deep so that it never drops before it
+            static size_t const MESSAGE_RING_BUFFER_SIZE = 128;
+            static size_t const RAW_DATA_RING_BUFFER_SIZE = MESSAGE_RING_BUFFER_SIZE;
         };
     }
 }
@@ -0,0 +1,209 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_TRACKCOLUMNS_HPP
+#define SENSORGATEWAY_TRACKCOLUMNS_HPP
+
+#include <vector>
+
+#include "Track.h"
+
+namespace DataFlow {
+
+    using TrackMask = std::vector<uint8_t>;
+
+    /**
+     * @brief Structure of arrays image of the populated tracks of a frame: each field of the tracks has its own
+     * contiguous column, so that the per-frame processing walks only the field it needs, in loops the compiler can
+     * vectorise. See the TrackKernels operating on the columns.
+     * @note The columns keep their capacity when assigned again, so that a reused instance does not allocate once it
+     * held as many tracks.
+     */
+    class TrackColumns {
+
+    public:
+
+        TrackColumns() = default;
+
+        ~TrackColumns() noexcept = default;
+
+        TrackColumns(TrackColumns const& other) = default;
+
+        TrackColumns(TrackColumns&& other) noexcept = default;
+
+        TrackColumns& operator=(TrackColumns const& other)& = default;
+
+        TrackColumns& operator=(TrackColumns&& other)& noexcept = default;
+
+        /**
+         * @param frame a SensorMessage or a SparseFrame, anything walking its populated tracks with forEachTrack
+         */
+        template<class FRAME>
+        void assign(FRAME const& frame) {
+            clear();
+            frame.forEachTrack([this](PixelId pixelId, Track const& track) {
+                pixelIds.push_back(pixelId);
+                ids.push_back(track.id);
+                confidenceLevels.push_back(track.confidenceLevel);
+                intensities.push_back(track.intensity);
+                accelerations.push_back(track.acceleration);
+                distances.push_back(track.distance);
+                speeds.push_back(track.speed);
+            });
+        }
+
+        /**
+         * @brief Keeps, in order, only the tracks whose mask is set, in every column.
+         */
+        void keepMasked(TrackMask const& mask) {
+            auto numberOfKeptTracks = size_t(0);
+            for (auto trackIndex = size_t(0); trackIndex < size(); ++trackIndex) {
+                if (mask[trackIndex]) {
+                    pixelIds[numberOfKeptTracks] = pixelIds[trackIndex];
+                    ids[numberOfKeptTracks] = ids[trackIndex];
+                    confidenceLevels[numberOfKeptTracks] = confidenceLevels[trackIndex];
+                    intensities[numberOfKeptTracks] = intensities[trackIndex];
+                    accelerations[numberOfKeptTracks] = accelerations[trackIndex];
+                    distances[numberOfKeptTracks] = distances[trackIndex];
+                    speeds[numberOfKeptTracks] = speeds[trackIndex];
+                    ++numberOfKeptTracks;
+                }
+            }
+            resize(numberOfKeptTracks);
+        }
+
+        Track trackAt(size_t trackIndex) const {
+            return Track(ids[trackIndex], confidenceLevels[trackIndex], intensities[trackIndex],
+                         accelerations[trackIndex], distances[trackIndex], speeds[trackIndex]);
+        }
+
+        size_t size() const noexcept {
+            return ids.size();
+        }
+
+        void clear() noexcept {
+            resize(0);
+        }
+
+        std::vector<PixelId> pixelIds;
+        std::vector<TrackId> ids;
+        std::vector<ConfidenceLevel> confidenceLevels;
+        std::vector<Intensity> intensities;
+        std::vector<Acceleration> accelerations;
+        std::vector<Distance> distances;
+        std::vector<Speed> speeds;
+
+    private:
+
+        void resize(size_t numberOfTracks) {
+            pixelIds.resize(numberOfTracks);
+            ids.resize(numberOfTracks);
+            confidenceLevels.resize(numberOfTracks);
+            intensities.resize(numberOfTracks);
+            accelerations.resize(numberOfTracks);
+            distances.resize(numberOfTracks);
+            speeds.resize(numberOfTracks);
+        }
+    };
+
+    /**
+     * @brief Kernels over a single column of TrackColumns. They are written as branch free loops over contiguous
+     * values, without aliasing between their input and output, so that they are vectorised by the compiler.
+     */
+    namespace TrackKernels {
+
+        template<class VALUE>
+        struct Extent {
+            VALUE minimum;
+            VALUE maximum;
+        };
+
+        /**
+         * @brief column = column * factor + offset, e.g.: a unit conversion or the conversion of the intensity to a
+         * signal to noise ratio.
+         */
+        template<class VALUE>
+        void scale(std::vector<VALUE>& column, VALUE factor, VALUE offset = VALUE(0)) noexcept {
+            auto* __restrict values = column.data();
+            auto const numberOfValues = column.size();
+            for (auto valueIndex = size_t(0); valueIndex < numberOfValues; ++valueIndex) {
+                values[valueIndex] = values[valueIndex] * factor + offset;
+            }
+        }
+
+        /**
+         * @brief Clears the mask of the values outside of [minimum, maximum], the mask is combined with its previous
+         * content so that several criteria can be chained.
+         * @return the number of values still masked
+         */
+        template<class VALUE>
+        size_t maskWithin(std::vector<VALUE> const& column, VALUE minimum, VALUE maximum, TrackMask& mask) {
+            auto const numberOfValues = column.size();
+            mask.resize(numberOfValues, 1);
+            auto const* __restrict values = column.data();
+            auto* __restrict masked = mask.data();
+            auto numberOfMaskedValues = size_t(0);
+            for (auto valueIndex = size_t(0); valueIndex < numberOfValues; ++valueIndex) {
+                auto isWithin = uint8_t(values[valueIndex] >= minimum) & uint8_t(values[valueIndex] <= maximum);
+                masked[valueIndex] &= isWithin;
+                numberOfMaskedValues += masked[valueIndex];
+            }
+            return numberOfMaskedValues;
+        }
+
+        /**
+         * @warning The column shall not be empty.
+         */
+        template<class VALUE>
+        Extent<VALUE> findExtent(std::vector<VALUE> const& column) noexcept {
+            auto const* __restrict values = column.data();
+            auto const numberOfValues = column.size();
+            Extent<VALUE> extent{values[0], values[0]};
+            for (auto valueIndex = size_t(1); valueIndex < numberOfValues; ++valueIndex) {
+                extent.minimum = values[valueIndex] < extent.minimum ? values[valueIndex] : extent.minimum;
+                extent.maximum = values[valueIndex] > extent.maximum ? values[valueIndex] : extent.maximum;
+            }
+            return extent;
+        }
+
+        /**
+         * @brief Counts the values in NUMBER_OF_BINS bins of the given width starting at the given lower bound. The
+         * values outside of the bins are counted in the first or in the last bin.
+         * @note The NaN values are not counted. A bin index that is not a number, e.g.: a value on the lower bound of
+         * bins of null width, is counted in the first bin.
+         */
+        template<size_t NUMBER_OF_BINS, class VALUE>
+        std::array<uint32_t, NUMBER_OF_BINS> buildHistogram(std::vector<VALUE> const& column, VALUE lowerBound,
+                                                            VALUE binWidth) noexcept {
+            std::array<uint32_t, NUMBER_OF_BINS> histogram{};
+            auto const* __restrict values = column.data();
+            auto const numberOfValues = column.size();
+            auto const lastBin = double(NUMBER_OF_BINS - 1);
+            for (auto valueIndex = size_t(0); valueIndex < numberOfValues; ++valueIndex) {
+                if (values[valueIndex] != values[valueIndex]) {
+                    continue;
+                }
+                auto bin = double(values[valueIndex] - lowerBound) / binWidth;
+                bin = !(bin >= 0) ? 0 : (bin > lastBin ? lastBin : bin);
+                ++histogram[static_cast<size_t>(bin)];
+            }
+            return histogram;
+        }
+    }
+}
+
+#endif //SENSORGATEWAY_TRACKCOLUMNS_HPP
@@ -61,6 +61,7 @@ void AWLTranslationStrategy::translateEndOfFrameMessage(SensorMessage&& sensorMe
     currentOutputMessage.sensorId = sensorId;
     MessageSource::produce(std::move(currentOutputMessage));
     currentOutputMessage = ServerMessage::returnDefaultData();
+    currentOutputMessageTrackIndex.clear();
 }
 
 void AWLTranslationStrategy::translateDetectionTrackMessage(SensorMessage&& sensorMessage) {
@@ -77,6 +78,9 @@ void AWLTranslationStrategy::addTrackInPixel(SensorMessage&& sensorMessage, Pixe
     track.confidenceLevel = confidenceLevel;
     track.intensity = convertIntensityToSNR(intensity);
     currentOutputMessage.addTrackToPixelWithId(pixelId, std::move(track));
+    auto const& pixel = currentOutputMessage.readPixels()[pixelId];
+    auto slot = static_cast<FrameTrackIndex::TrackSlot>(pixel.getCurrentNumberOfTracksInPixel() - 1);
+    currentOutputMessageTrackIndex.record(trackId, pixelId, slot);
 };
 
 void AWLTranslationStrategy::translateDetectionVelocityMessage(SensorMessage&& sensorMessage) {
@@ -85,6 +89,9 @@ void AWLTranslationStrategy::translateDetectionVelocityMessage(SensorMessage&& s
     Acceleration acceleration = convertTwoBytesToSignedBigEndian(sensorMessage.data[6], sensorMessage.data[7]);
     TrackId trackId = convertTwoBytesToUnsignedBigEndian(sensorMessage.data[0], sensorMessage.data[1]);
     auto track = fetchTrack(trackId);
+    if (track == nullptr) {
+        return;
+    }
     track->distance = distance / ConversionUnits::NUMBER_OF_CENTIMETERS_IN_A_METER;
     track->speed = speed / ConversionUnits::NUMBER_OF_CENTIMETERS_IN_A_METER;
     track->acceleration = acceleration / ConversionUnits::NUMBER_OF_CENTIMETERS_IN_A_METER;
@@ -92,13 +99,11 @@ void AWLTranslationStrategy::translateDetectionVelocityMessage(SensorMessage&& s
 
 
 Track* AWLTranslationStrategy::fetchTrack(TrackId const& trackId) {
-    auto pixels = currentOutputMessage.getPixels();
-    for (auto i = 0; i < NUMBER_OF_PIXELS; ++i) {
-        auto pixel = &pixels->at(static_cast<unsigned long>(i));
-        if (pixel->doesTrackExist(trackId)) {
-            return pixel->fetchTrackById(trackId);
-        }
+    auto location = currentOutputMessageTrackIndex.find(trackId);
+    if (location == nullptr) {
+        return nullptr;
     }
-    return nullptr;
+    auto& pixel = (*currentOutputMessage.holdPixels())[location->pixelId];
+    return &(*pixel.getTracks())[location->slot];
 }
 
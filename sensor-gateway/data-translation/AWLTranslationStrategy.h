@@ -17,6 +17,7 @@
 #include "sensor-gateway/common/data-structure/spirit/SpiritStructures.h"
 #include "sensor-gateway/common/data-structure/sensor/AWLStructures.h"
 #include "DataTranslationStrategy.hpp"
+#include "TrackIndex.hpp"
 
 namespace DataTranslation {
 
@@ -24,7 +25,8 @@ namespace DataTranslation {
     using AWLSpiritStructures = Sensor::Spirit::Structures<
             AWLStructures::AWLMessageDefinition,
             AWLStructures::AWLRawDataDefinition,
-            AWLStructures::AWLCommandDefinition
+            AWLStructures::AWLCommandDefinition,
+            DataFlow::NumericEncoding::AWLTrackEncoding
             >;
 
     class AWLTranslationStrategy final : public DataTranslationStrategy<AWLStructures, AWLSpiritStructures> {
@@ -57,6 +59,11 @@ namespace DataTranslation {
 
         using super::currentOutputMessage;
 
+        using FrameTrackIndex = TrackIndex<Sensor::AWL::_16::NUMBER_OF_PIXELS *
+                                           Sensor::AWL::_16::NUMBER_OF_TRACKS_IN_PIXEL>;
+
+        FrameTrackIndex currentOutputMessageTrackIndex;
+
         void addTrackInPixel(SensorMessage&& sensorMessage, DataFlow::PixelId pixelId);
 
         Track* fetchTrack(DataFlow::TrackId const& trackId);
@@ -18,8 +18,9 @@
 namespace DataTranslation {
 
     template<class SENSOR_STRUCTURES, class SERVER_STRUCTURES>
-    class DataTranslationStrategy : public DataFlow::DataSource<typename SERVER_STRUCTURES::Message>,
-                                    public DataFlow::DataSource<typename SERVER_STRUCTURES::RawData> {
+    class DataTranslationStrategy
+            : public DataFlow::DataSource<typename SERVER_STRUCTURES::Message, SERVER_STRUCTURES::MESSAGE_RING_BUFFER_SIZE>,
+              public DataFlow::DataSource<typename SERVER_STRUCTURES::RawData, SERVER_STRUCTURES::RAW_DATA_RING_BUFFER_SIZE> {
 
     protected:
         using SensorMessage = typename SENSOR_STRUCTURES::Message;
@@ -28,8 +29,8 @@ namespace DataTranslation {
         using ServerMessage = typename SERVER_STRUCTURES::Message;
         using ServerRawData = typename SERVER_STRUCTURES::RawData;
 
-        using MessageSource = DataFlow::DataSource<ServerMessage>;
-        using RawDataSource = DataFlow::DataSource<ServerRawData>;
+        using MessageSource = DataFlow::DataSource<ServerMessage, SERVER_STRUCTURES::MESSAGE_RING_BUFFER_SIZE>;
+        using RawDataSource = DataFlow::DataSource<ServerRawData, SERVER_STRUCTURES::RAW_DATA_RING_BUFFER_SIZE>;
 
     public:
         DataTranslationStrategy() :
@@ -53,6 +54,10 @@ namespace DataTranslation {
 
         using RawDataSource::linkConsumer;
 
+        bool isOutputCongested() const noexcept {
+            return MessageSource::isOutputCongested() || RawDataSource::isOutputCongested();
+        }
+
     protected:
 
         ServerMessage currentOutputMessage;
@@ -18,21 +18,28 @@
 
 namespace SensorAccessLinkElement {
 
-    template<class SENSOR_STRUCTURES, class SERVER_STRUCTURES>
-    class DataTranslator : public DataFlow::DataSink<typename SENSOR_STRUCTURES::Message>,
+    /**
+     * @tparam DATA_TRANSLATION_STRATEGY the abstract DataTranslationStrategy by default. With a final concrete strategy,
+     * the translation is resolved at compile time and can be inlined in the batches consumed by the scheduler.
+     */
+    template<class SENSOR_STRUCTURES, class SERVER_STRUCTURES,
+            class DATA_TRANSLATION_STRATEGY = DataTranslation::DataTranslationStrategy<SENSOR_STRUCTURES, SERVER_STRUCTURES>>
+    class DataTranslator final : public DataFlow::DataSink<typename SENSOR_STRUCTURES::Message>,
                            public DataFlow::DataSink<typename SENSOR_STRUCTURES::RawData>,
-                           public DataFlow::DataSource<ErrorHandling::SensorAccessLinkError> {
+                           public DataFlow::MultiProducerDataSource<ErrorHandling::SensorAccessLinkError,
+                                   DataFlow::ERROR_RING_BUFFER_SIZE> {
 
     protected:
 
-        using DataTranslationStrategy = DataTranslation::DataTranslationStrategy<SENSOR_STRUCTURES, SERVER_STRUCTURES>;
+        using DataTranslationStrategy = DATA_TRANSLATION_STRATEGY;
 
         using SensorMessage = typename SENSOR_STRUCTURES::Message;
         using SensorRawData = typename SENSOR_STRUCTURES::RawData;
 
         using MessageSink = DataFlow::DataSink<SensorMessage>;
         using RawDataSink = DataFlow::DataSink<SensorRawData>;
-        using ErrorSource = DataFlow::DataSource<ErrorHandling::SensorAccessLinkError>;
+        using ErrorSource =
+        DataFlow::MultiProducerDataSource<ErrorHandling::SensorAccessLinkError, DataFlow::ERROR_RING_BUFFER_SIZE>;
 
     public:
 
@@ -81,6 +88,26 @@ namespace SensorAccessLinkElement {
             }
         };
 
+        /**
+         * @note The scheduler resolves the batch through this final class, and the data are then translated without
+         * a virtual call per datum.
+         */
+        void consumeBatch(DataFlow::DataBatch<SensorMessage>& messages) override {
+            messages.forEach([this](SensorMessage& message) {
+                DataTranslator::consume(std::move(message));
+            });
+        }
+
+        void consumeBatch(DataFlow::DataBatch<SensorRawData>& rawData) override {
+            rawData.forEach([this](SensorRawData& rawDatum) {
+                DataTranslator::consume(std::move(rawDatum));
+            });
+        }
+
+        bool isFallingBehind() const noexcept override {
+            return dataTranslationStrategy->isOutputCongested();
+        }
+
     private:
 
         DataTranslationStrategy* dataTranslationStrategy;
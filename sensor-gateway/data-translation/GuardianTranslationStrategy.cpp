@@ -66,6 +66,7 @@ void GuardianTranslationStrategy::translateEndOfFrameMessage(SensorMessage&& sen
     currentOutputMessage.messageId = messageId;
     MessageSource::produce(std::move(currentOutputMessage));
     currentOutputMessage = ServerMessage::returnDefaultData();
+    currentOutputMessageTrackIndex.clear();
 }
 
 void GuardianTranslationStrategy::translateDetectionTrackMessage(SensorMessage&& sensorMessage) {
@@ -82,6 +83,9 @@ void GuardianTranslationStrategy::addTrackInPixel(SensorMessage&& sensorMessage,
     track.confidenceLevel = confidenceLevel;
     track.intensity = intensity;
     currentOutputMessage.addTrackToPixelWithId(pixelId, std::move(track));
+    auto const& pixel = currentOutputMessage.readPixels()[pixelId];
+    auto slot = static_cast<FrameTrackIndex::TrackSlot>(pixel.getCurrentNumberOfTracksInPixel() - 1);
+    currentOutputMessageTrackIndex.record(trackId, pixelId, slot);
 };
 
 void GuardianTranslationStrategy::translateDetectionVelocityMessage(SensorMessage&& sensorMessage) {
@@ -90,20 +94,21 @@ void GuardianTranslationStrategy::translateDetectionVelocityMessage(SensorMessag
     Acceleration acceleration = convertTwoBytesToSignedBigEndian(sensorMessage.data[6], sensorMessage.data[7]);
     TrackId trackId = convertTwoBytesToUnsignedBigEndian(sensorMessage.data[0], sensorMessage.data[1]);
     auto track = fetchTrack(trackId);
+    if (track == nullptr) {
+        return;
+    }
     track->distance = distance;
     track->speed = speed;
     track->acceleration = acceleration;
 }
 
 Track* GuardianTranslationStrategy::fetchTrack(TrackId const& trackId) {
-    auto pixels = currentOutputMessage.getPixels();
-    for (auto i = 0; i < NUMBER_OF_PIXELS; ++i) {
-        auto pixel = &pixels->at(i);
-        if (pixel->doesTrackExist(trackId)) {
-            return pixel->fetchTrackById(trackId);
-        }
+    auto location = currentOutputMessageTrackIndex.find(trackId);
+    if (location == nullptr) {
+        return nullptr;
     }
-    return nullptr;
+    auto& pixel = (*currentOutputMessage.holdPixels())[location->pixelId];
+    return &(*pixel.getTracks())[location->slot];
 }
 
 void GuardianTranslationStrategy::reverseRawDataDefinitionEndianness(SensorRawData* sensorRawData) {
@@ -17,6 +17,7 @@
 #include "sensor-gateway/common/data-structure/spirit/SpiritStructures.h"
 #include "sensor-gateway/common/data-structure/sensor/GuardianStructures.h"
 #include "DataTranslationStrategy.hpp"
+#include "TrackIndex.hpp"
 
 namespace DataTranslation {
 
@@ -24,7 +25,8 @@ namespace DataTranslation {
     using GuardianSpiritStructures = Sensor::Spirit::Structures<
             GuardianStructures::GuardianMessageDefinition,
             GuardianStructures::GuardianRawDataDefinition,
-            GuardianStructures::GuardianCommandDefinition
+            GuardianStructures::GuardianCommandDefinition,
+            DataFlow::NumericEncoding::GuardianTrackEncoding
     >;
 
     class GuardianTranslationStrategy final
@@ -57,6 +59,11 @@ namespace DataTranslation {
 
         using super::currentOutputMessage;
 
+        using FrameTrackIndex = TrackIndex<GuardianSpiritStructures::GatewaySensorMessageDefinition::NUMBER_OF_PIXELS *
+                                           std::tuple_size<DataFlow::TracksArray>::value>;
+
+        FrameTrackIndex currentOutputMessageTrackIndex;
+
         void addTrackInPixel(SensorMessage&& sensorMessage, DataFlow::PixelId pixelId);
 
         Track* fetchTrack(DataFlow::TrackId const& trackId);
@@ -0,0 +1,169 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_TRACKINDEX_HPP
+#define SENSORGATEWAY_TRACKINDEX_HPP
+
+#include <array>
+
+#include "sensor-gateway/common/TypeDefinition.h"
+
+namespace DataTranslation {
+
+    /**
+     * @brief Maps the id of each track added to the frame under translation to the pixel and the slot holding it, so
+     * that the messages completing a track find it in constant time instead of scanning every pixel.
+     * @details The ids are direct-mapped into a table sized to twice the number of tracks a frame can hold, collisions
+     * go to the next entry. Each entry is stamped with the frame it was recorded in, so clearing the index only has to
+     * move on to the next frame.
+     * @note When the same id is recorded twice in a frame, the first location is kept.
+     * @note A track recorded while the table is full is dropped and counted, see fetchNumberOfDroppedRecords. It can
+     * only happen when a frame holds more than MAXIMUM_NUMBER_OF_TRACKS tracks.
+     */
+    template<std::size_t MAXIMUM_NUMBER_OF_TRACKS>
+    class TrackIndex final {
+
+    public:
+
+        using TrackSlot = uint16_t;
+
+        struct Location {
+            DataFlow::PixelId pixelId;
+            TrackSlot slot;
+        };
+
+        TrackIndex() :
+                currentFrame(FIRST_FRAME),
+                numberOfDroppedRecords(0),
+                entries() {
+        }
+
+        ~TrackIndex() noexcept = default;
+
+        /**
+         * @warning The TrackIndexes are intended to be used as const instances. They shouldn't be moved.
+         */
+        TrackIndex(TrackIndex&& other) noexcept = delete;
+
+        /**
+         * @warning The TrackIndexes are intended to be used as const instances. They shouldn't be copied.
+         */
+        TrackIndex(TrackIndex const& other) = delete;
+
+        /**
+         * @warning The TrackIndexes are intended to be used as const instances. They shouldn't be assigned.
+         */
+        TrackIndex& operator=(TrackIndex const& other) = delete;
+
+        /**
+         * @warning The TrackIndexes are intended to be used as const instances. They shouldn't be assigned.
+         */
+        TrackIndex& operator=(TrackIndex&& other) = delete;
+
+        void record(DataFlow::TrackId const& trackId, DataFlow::PixelId const& pixelId, TrackSlot const& slot) noexcept {
+            auto entryIndex = firstEntryIndexOf(trackId);
+            for (auto probe = 0u; probe < NUMBER_OF_ENTRIES; ++probe) {
+                auto& entry = entries[entryIndex];
+                if (entry.frame != currentFrame) {
+                    entry.frame = currentFrame;
+                    entry.trackId = trackId;
+                    entry.location = {pixelId, slot};
+                    return;
+                }
+                if (entry.trackId == trackId) {
+                    return;
+                }
+                entryIndex = nextEntryIndex(entryIndex);
+            }
+            ++numberOfDroppedRecords;
+        }
+
+        /**
+         * @return The location of the track, or nullptr when it has not been recorded in the current frame.
+         */
+        Location const* find(DataFlow::TrackId const& trackId) const noexcept {
+            auto entryIndex = firstEntryIndexOf(trackId);
+            for (auto probe = 0u; probe < NUMBER_OF_ENTRIES; ++probe) {
+                auto const& entry = entries[entryIndex];
+                if (entry.frame != currentFrame) {
+                    return nullptr;
+                }
+                if (entry.trackId == trackId) {
+                    return &entry.location;
+                }
+                entryIndex = nextEntryIndex(entryIndex);
+            }
+            return nullptr;
+        }
+
+        uint32_t fetchNumberOfDroppedRecords() const noexcept {
+            return numberOfDroppedRecords;
+        }
+
+        void clear() noexcept {
+            ++currentFrame;
+            if (currentFrame == UNRECORDED_FRAME) {
+                for (auto& entry : entries) {
+                    entry.frame = UNRECORDED_FRAME;
+                }
+                currentFrame = FIRST_FRAME;
+            }
+        }
+
+    private:
+
+        using Frame = uint32_t;
+
+        struct Entry {
+            Frame frame = UNRECORDED_FRAME;
+            DataFlow::TrackId trackId;
+            Location location;
+        };
+
+        static constexpr std::size_t roundUpToPowerOfTwo(std::size_t value) noexcept {
+            std::size_t powerOfTwo = 1;
+            while (powerOfTwo < value) {
+                powerOfTwo <<= 1u;
+            }
+            return powerOfTwo;
+        }
+
+        static constexpr Frame UNRECORDED_FRAME = 0;
+        static constexpr Frame FIRST_FRAME = 1;
+        static constexpr std::size_t NUMBER_OF_ENTRIES = roundUpToPowerOfTwo(2 * MAXIMUM_NUMBER_OF_TRACKS);
+        static constexpr std::size_t ENTRY_INDEX_MASK = NUMBER_OF_ENTRIES - 1;
+
+        static std::size_t firstEntryIndexOf(DataFlow::TrackId const& trackId) noexcept {
+            return trackId & ENTRY_INDEX_MASK;
+        }
+
+        static std::size_t nextEntryIndex(std::size_t entryIndex) noexcept {
+            return (entryIndex + 1) & ENTRY_INDEX_MASK;
+        }
+
+        Frame currentFrame;
+        uint32_t numberOfDroppedRecords;
+        std::array<Entry, NUMBER_OF_ENTRIES> entries;
+    };
+
+    template<std::size_t MAXIMUM_NUMBER_OF_TRACKS>
+    constexpr typename TrackIndex<MAXIMUM_NUMBER_OF_TRACKS>::Frame TrackIndex<MAXIMUM_NUMBER_OF_TRACKS>::UNRECORDED_FRAME;
+
+    template<std::size_t MAXIMUM_NUMBER_OF_TRACKS>
+    constexpr typename TrackIndex<MAXIMUM_NUMBER_OF_TRACKS>::Frame TrackIndex<MAXIMUM_NUMBER_OF_TRACKS>::FIRST_FRAME;
+}
+
+#endif //SENSORGATEWAY_TRACKINDEX_HPP
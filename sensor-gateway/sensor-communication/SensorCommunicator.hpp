@@ -22,23 +22,29 @@
 
 namespace SensorAccessLinkElement {
 
-    template<class T>
-    class SensorCommunicator : public DataFlow::DataSource<typename T::Message>,
-                               public DataFlow::DataSource<typename T::RawData>,
-                               public DataFlow::DataSource<ErrorHandling::SensorAccessLinkError> {
+    /**
+     * @tparam SENSOR_COMMUNICATION_STRATEGY the abstract SensorCommunicationStrategy by default. A final concrete
+     * strategy lets the compiler resolve, and inline, the calls to the strategy.
+     */
+    template<class T, class SENSOR_COMMUNICATION_STRATEGY = SensorCommunication::SensorCommunicationStrategy<T>>
+    class SensorCommunicator final : public DataFlow::DataSource<typename T::Message, T::MESSAGE_RING_BUFFER_SIZE>,
+                               public DataFlow::DataSource<typename T::RawData, T::RAW_DATA_RING_BUFFER_SIZE>,
+                               public DataFlow::MultiProducerDataSource<ErrorHandling::SensorAccessLinkError,
+                                       DataFlow::ERROR_RING_BUFFER_SIZE> {
 
     protected:
 
-        typedef SensorCommunication::SensorCommunicationStrategy<T> SensorCommunicationStrategy;
+        typedef SENSOR_COMMUNICATION_STRATEGY SensorCommunicationStrategy;
 
         using MESSAGE = typename T::Message;
         using RAW_DATA = typename T::RawData;
         using MESSAGES = typename SensorCommunicationStrategy::Messages;
         using RAW_DATA_CYCLES = typename SensorCommunicationStrategy::RawDataCycles;
 
-        using MessageSource = DataFlow::DataSource<MESSAGE>;
-        using RawDataSource = DataFlow::DataSource<RAW_DATA>;
-        using ErrorSource = DataFlow::DataSource<ErrorHandling::SensorAccessLinkError>;
+        using MessageSource = DataFlow::DataSource<MESSAGE, T::MESSAGE_RING_BUFFER_SIZE>;
+        using RawDataSource = DataFlow::DataSource<RAW_DATA, T::RAW_DATA_RING_BUFFER_SIZE>;
+        using ErrorSource =
+        DataFlow::MultiProducerDataSource<ErrorHandling::SensorAccessLinkError, DataFlow::ERROR_RING_BUFFER_SIZE>;
 
         MESSAGE const DEFAULT_MESSAGE = T::Message::returnDefaultData();
         RAW_DATA const DEFAULT_RAW_DATA = T::RawData::returnDefaultData();
@@ -46,6 +52,7 @@ namespace SensorAccessLinkElement {
     public:
         explicit SensorCommunicator(SensorCommunicationStrategy* sensorCommunicationStrategy) :
                 terminateOrderReceived(false),
+                numberOfRawDataPollingsSkipped(0),
                 sensorCommunicationStrategy(sensorCommunicationStrategy),
                 communicatorThread(JoinableThread(doNothing)) {
             communicatorThread.exitSafely();
@@ -104,12 +111,31 @@ namespace SensorAccessLinkElement {
         void run() {
             while (!terminateOrderHasBeenReceived()) {
                 handleIncomingMessages();
-                handleIncomingRawData();
+                if (hasToPollRawData()) {
+                    handleIncomingRawData();
+                }
                 // TODO : investigate the advantages of sleep and/or yield here.
                 std::this_thread::yield();
             }
         }
 
+        /**
+         * @brief Back pressure: while the pipeline downstream is congested, the raw data cycles are only polled once
+         * every few iterations. Raw data are shed at the source, a whole cycle at a time, instead of being lost inside the
+         * rings, and the messages keep flowing.
+         */
+        bool hasToPollRawData() noexcept {
+            if (!MessageSource::isOutputCongested() && !RawDataSource::isOutputCongested()) {
+                numberOfRawDataPollingsSkipped = 0;
+                return true;
+            }
+            if (++numberOfRawDataPollingsSkipped < DataFlow::RAW_DATA_POLLING_DECIMATION_UNDER_BACK_PRESSURE) {
+                return false;
+            }
+            numberOfRawDataPollingsSkipped = 0;
+            return true;
+        }
+
         void handleIncomingMessages() {
             MESSAGES messages;
             try {
@@ -119,12 +145,8 @@ namespace SensorAccessLinkElement {
                                         ErrorHandling::Origin::SENSOR_COMMUNICATOR_HANDLE_MESSAGE);
             }
 
-            for (auto messageIndex = 0; messageIndex < messages.size(); ++messageIndex) {
-                auto message = messages[messageIndex];
-                if (message != DEFAULT_MESSAGE) {
-                    MessageSource::produce(std::move(message));
-                }
-            }
+            auto lastMessage = std::remove(messages.begin(), messages.end(), DEFAULT_MESSAGE);
+            MessageSource::produceBatch(messages.begin(), lastMessage);
         }
 
         void handleIncomingRawData() {
@@ -136,12 +158,8 @@ namespace SensorAccessLinkElement {
                                         ErrorHandling::Origin::SENSOR_COMMUNICATOR_HANDLE_RAWDATA);
             }
 
-            for (auto rawDataIndex = 0; rawDataIndex < rawDataCycles.size(); ++rawDataIndex) {
-                auto rawDataCycle = rawDataCycles[rawDataIndex];
-                if (rawDataCycle != DEFAULT_RAW_DATA) {
-                    RawDataSource::produce(std::move(rawDataCycle));
-                }
-            }
+            auto lastRawDataCycle = std::remove(rawDataCycles.begin(), rawDataCycles.end(), DEFAULT_RAW_DATA);
+            RawDataSource::produceBatch(rawDataCycles.begin(), lastRawDataCycle);
         }
 
         void addOriginAndHandleError(ErrorHandling::SensorAccessLinkError&& error, std::string const& originToAdd) {
@@ -173,6 +191,8 @@ namespace SensorAccessLinkElement {
 
         AtomicFlag terminateOrderReceived;
 
+        uint8_t numberOfRawDataPollingsSkipped;
+
         SensorCommunicationStrategy* sensorCommunicationStrategy;
     };
 }
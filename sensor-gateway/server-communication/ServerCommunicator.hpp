@@ -20,21 +20,27 @@
 namespace SensorAccessLinkElement {
 
     // TODO: use parameter pack expansion to create an automatic {sink, consume, format} function addition for a list of type for the SpiritProtocol
-    template<class T>
-    class ServerCommunicator : public DataFlow::DataSink<typename T::Message>,
+    /**
+     * @tparam SERVER_COMMUNICATION_STRATEGY the abstract ServerCommunicationStrategy by default. A final concrete
+     * strategy lets the compiler resolve, and inline, the calls to the strategy.
+     */
+    template<class T, class SERVER_COMMUNICATION_STRATEGY = ServerCommunication::ServerCommunicationStrategy<T>>
+    class ServerCommunicator final : public DataFlow::DataSink<typename T::Message>,
                                public DataFlow::DataSink<typename T::RawData>,
-                               public DataFlow::DataSource<ErrorHandling::SensorAccessLinkError> {
+                               public DataFlow::MultiProducerDataSource<ErrorHandling::SensorAccessLinkError,
+                                       DataFlow::ERROR_RING_BUFFER_SIZE> {
 
     protected:
 
-        using ServerCommunicationStrategy = ServerCommunication::ServerCommunicationStrategy<T>;
+        using ServerCommunicationStrategy = SERVER_COMMUNICATION_STRATEGY;
 
         using Message = typename T::Message;
         using RawData = typename T::RawData;
 
         using MessageSink = DataFlow::DataSink<Message>;
         using RawDataSink = DataFlow::DataSink<RawData>;
-        using ErrorSource = DataFlow::DataSource<ErrorHandling::SensorAccessLinkError>;
+        using ErrorSource =
+        DataFlow::MultiProducerDataSource<ErrorHandling::SensorAccessLinkError, DataFlow::ERROR_RING_BUFFER_SIZE>;
 
     public:
 
@@ -64,7 +70,7 @@ namespace SensorAccessLinkElement {
 
         void consume(Message&& message) override {
             try {
-                message.addTimePointForGatewayWithLocation(Metrics::LocationNames::SERVER_COMMUNICATOR_SENDING);
+                message.addTimePointForGatewayWithLocation(Metrics::Locations::SERVER_COMMUNICATOR_SENDING);
                 serverCommunicationStrategy->sendMessage(std::move(message));
             } catch (ErrorHandling::SensorAccessLinkError& strategyError) {
                 addOriginAndHandleError(std::move(strategyError),
@@ -81,6 +87,22 @@ namespace SensorAccessLinkElement {
             }
         }
 
+        /**
+         * @note The scheduler resolves the batch through this final class, and the data are then sent without a
+         * virtual call per datum.
+         */
+        void consumeBatch(DataFlow::DataBatch<Message>& messages) override {
+            messages.forEach([this](Message& message) {
+                ServerCommunicator::consume(std::move(message));
+            });
+        }
+
+        void consumeBatch(DataFlow::DataBatch<RawData>& rawData) override {
+            rawData.forEach([this](RawData& rawDatum) {
+                ServerCommunicator::consume(std::move(rawDatum));
+            });
+        }
+
         void closeConnection() {
             try {
                 serverCommunicationStrategy->closeConnection();
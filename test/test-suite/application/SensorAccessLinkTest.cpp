@@ -338,6 +338,38 @@ TEST_F(SensorAccessLinkTest,
     ASSERT_EQ(createdDataList.size(), receivedDataList.size());
 }
 
+/**
+ * Medium test
+ */
+TEST_F(SensorAccessLinkTest,
+       given_aStaticallyComposedSensorAccessLink_when_executing_then_theSameNumberOfMessagesEndsUpInTheServerCommunicationStrategy) {
+    using StaticallyComposedSensorAccessLink = SensorGateway::SensorAccessLink<
+            Sensor::Test::Simple::Structures, Sensor::Test::Simple::Structures,
+            SensorAccessLinkTestMock::MockServerCommunicationStrategy,
+            SensorAccessLinkTestMock::MockTranslationStrategy,
+            SensorAccessLinkTestMock::MockSensorCommunicationStrategy>;
+    uint8_t numberOfMessagesToProcess = 42;
+    uint8_t numberOfRawDataToProcess = 0;
+    SensorAccessLinkTestMock::MockSensorCommunicationStrategy mockSensorCommunicationStrategy(
+            numberOfMessagesToProcess, numberOfRawDataToProcess);
+    SensorAccessLinkTestMock::MockTranslationStrategy mockTranslationStrategy;
+    SensorAccessLinkTestMock::MockServerCommunicationStrategy mockServerCommunicationStrategy;
+    StaticallyComposedSensorAccessLink sensorAccessLink(&mockServerCommunicationStrategy,
+                                                        &mockTranslationStrategy,
+                                                        &mockSensorCommunicationStrategy);
+
+    sensorAccessLink.start(FAKE_SERVER_ADDRESS);
+    mockSensorCommunicationStrategy.waitUntilFetchMessagesHasBeenCalledEnough();
+    mockSensorCommunicationStrategy.waitUntilFetchRawDataCyclesHasBeenCalledEnough();
+
+    sensorAccessLink.terminateAndJoin();
+
+    auto createdDataList = mockSensorCommunicationStrategy.getCreatedMessageCopies();
+    auto receivedDataList = mockServerCommunicationStrategy.getReceivedMessages();
+
+    ASSERT_EQ(createdDataList.size(), receivedDataList.size());
+}
+
 /**
  * Medium test
  */
@@ -0,0 +1,57 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_BLOCKPOOLTEST_CPP
+#define SENSORGATEWAY_BLOCKPOOLTEST_CPP
+
+#include <gtest/gtest.h>
+#include "sensor-gateway/common/container/BlockPool.hpp"
+
+class BlockPoolTest : public ::testing::Test {
+protected:
+
+    BlockPoolTest() = default;
+
+    virtual ~BlockPoolTest() = default;
+
+    using Content = std::array<int, 4>;
+    using ContentPool = Container::BlockPool<Content>;
+
+    Content const SOME_CONTENT = {{1, 2, 3, 4}};
+    Content const SOME_OTHER_CONTENT = {{5, 6, 7, 8}};
+};
+
+TEST_F(BlockPoolTest, given_someContent_when_acquireCopyOf_then_returnsABlockHoldingACopyOfTheContent) {
+    auto block = ContentPool::shared().acquireCopyOf(SOME_CONTENT);
+
+    ASSERT_EQ(SOME_CONTENT, *block);
+}
+
+TEST_F(BlockPoolTest, given_aReleasedBlock_when_acquireCopyOf_then_reusesTheReleasedBlockWithoutAllocating) {
+    auto block = ContentPool::shared().acquireCopyOf(SOME_CONTENT);
+    auto releasedBlock = block.get();
+    block.reset();
+    auto numberOfFreeBlocksAfterRelease = ContentPool::shared().fetchNumberOfFreeBlocks();
+
+    auto reacquiredBlock = ContentPool::shared().acquireCopyOf(SOME_OTHER_CONTENT);
+
+    ASSERT_EQ(releasedBlock, reacquiredBlock.get());
+    ASSERT_EQ(SOME_OTHER_CONTENT, *reacquiredBlock);
+    ASSERT_EQ(numberOfFreeBlocksAfterRelease - 1, ContentPool::shared().fetchNumberOfFreeBlocks());
+}
+
+#endif //SENSORGATEWAY_BLOCKPOOLTEST_CPP
@@ -0,0 +1,133 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_CONFLATINGRINGBUFFERTEST_CPP
+#define SENSORGATEWAY_CONFLATINGRINGBUFFERTEST_CPP
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-flow/ConflatingRingBuffer.hpp"
+#include "test/utilities/data-model/DataModelFixture.h"
+#include "test/utilities/mock/ConsumerLinkMock.h"
+
+using DataModel::SimpleMessage;
+
+using MockConsumerLink = Mock::ConsumerLinkMock<SimpleMessage>;
+
+class ConflatingRingBufferTest : public ::testing::Test {
+protected:
+
+    ConflatingRingBufferTest() = default;
+
+    virtual ~ConflatingRingBufferTest() = default;
+
+    struct FirstContentOf {
+        std::string operator()(SimpleMessage const& message) const noexcept {
+            return message.getContent()[0];
+        }
+    };
+
+    using ConflatingBuffer = DataFlow::ConflatingRingBuffer<SimpleMessage, FirstContentOf>;
+
+    static SimpleMessage createMessage(std::string const& key, std::string const& value) {
+        return SimpleMessage(SimpleMessage::Content({key, value}), DataModel::Defaults::DEFAULT_SERVICE_TIMESTAMPS);
+    }
+
+    static std::vector<SimpleMessage> consumeEveryBatchFor(ConflatingBuffer* buffer, MockConsumerLink* consumer) {
+        std::vector<SimpleMessage> consumedData;
+        auto numberOfConsumedData = consumedData.size() + 1;
+        while (numberOfConsumedData != consumedData.size()) {
+            numberOfConsumedData = consumedData.size();
+            auto batch = buffer->consumeUpTo(consumer, DataFlow::MAXIMUM_NUMBER_OF_DATA_PER_BATCH);
+            batch.forEach([&consumedData](SimpleMessage const& data) {
+                consumedData.push_back(data);
+            });
+            buffer->releaseClaimedDataFor(consumer);
+        }
+        return consumedData;
+    }
+};
+
+TEST_F(ConflatingRingBufferTest,
+       given_aConsumerLaggingBehindSeveralDataOfTheSameKey_when_consumeUpTo_then_returnsOnlyTheNewestDataAndCountsTheOthersAsLost) {
+    ConflatingBuffer buffer;
+    MockConsumerLink consumer;
+    buffer.linkWith(&consumer);
+    for (auto frame = 0; frame < 5; ++frame) {
+        buffer.write(createMessage("sensor", std::to_string(frame)));
+    }
+
+    auto consumedData = consumeEveryBatchFor(&buffer, &consumer);
+
+    ASSERT_EQ(std::vector<SimpleMessage>({createMessage("sensor", "4")}), consumedData);
+    ASSERT_EQ(4u, buffer.fetchNumberOfLostDataFor(&consumer));
+}
+
+TEST_F(ConflatingRingBufferTest,
+       given_aLaggingConsumerAndInterleavedKeys_when_consumeUpTo_then_returnsTheNewestDataOfEachKeyInWrittenOrder) {
+    ConflatingBuffer buffer;
+    MockConsumerLink consumer;
+    buffer.linkWith(&consumer);
+    buffer.write(createMessage("front", "0"));
+    buffer.write(createMessage("rear", "0"));
+    buffer.write(createMessage("side", "0"));
+    buffer.write(createMessage("rear", "1"));
+    buffer.write(createMessage("front", "1"));
+
+    auto consumedData = consumeEveryBatchFor(&buffer, &consumer);
+
+    auto expectedData = std::vector<SimpleMessage>(
+            {createMessage("side", "0"), createMessage("rear", "1"), createMessage("front", "1")});
+    ASSERT_EQ(expectedData, consumedData);
+    ASSERT_EQ(2u, buffer.fetchNumberOfLostDataFor(&consumer));
+}
+
+TEST_F(ConflatingRingBufferTest,
+       given_aConsumerKeepingUpWithTheWriter_when_consumeNextDataFor_then_everyDataIsConsumedAndNoneIsLost) {
+    ConflatingBuffer buffer;
+    MockConsumerLink consumer;
+    buffer.linkWith(&consumer);
+
+    buffer.write(createMessage("sensor", "0"));
+    auto firstConsumedData = SimpleMessage(buffer.consumeNextDataFor(&consumer));
+    buffer.write(createMessage("sensor", "1"));
+    auto secondConsumedData = SimpleMessage(buffer.consumeNextDataFor(&consumer));
+
+    ASSERT_EQ(createMessage("sensor", "0"), firstConsumedData);
+    ASSERT_EQ(createMessage("sensor", "1"), secondConsumedData);
+    ASSERT_EQ(0u, buffer.fetchNumberOfLostDataFor(&consumer));
+}
+
+TEST_F(ConflatingRingBufferTest,
+       given_aLaggingConsumerAndDataWrittenAsABatch_when_claimNextDataFor_then_claimsTheNewestDataOfTheKey) {
+    ConflatingBuffer buffer;
+    MockConsumerLink consumer;
+    buffer.linkWith(&consumer);
+    std::vector<SimpleMessage> frames({createMessage("sensor", "0"), createMessage("sensor", "1"),
+                                       createMessage("sensor", "2")});
+    buffer.writeBatch(frames.begin(), frames.end());
+
+    auto claimedData = SimpleMessage(buffer.claimNextDataFor(&consumer));
+    buffer.releaseClaimedDataFor(&consumer);
+
+    ASSERT_EQ(createMessage("sensor", "2"), claimedData);
+    ASSERT_EQ(2u, buffer.fetchNumberOfLostDataFor(&consumer));
+    ASSERT_FALSE(consumer.isActive());
+}
+
+#endif //SENSORGATEWAY_CONFLATINGRINGBUFFERTEST_CPP
@@ -0,0 +1,105 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_CONSTANTSIZEDATOMICBITSETTEST_CPP
+#define SENSORGATEWAY_CONSTANTSIZEDATOMICBITSETTEST_CPP
+
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/container/ConstantSizedAtomicBitset.hpp"
+
+class ConstantSizedAtomicBitsetTest : public ::testing::Test {
+protected:
+
+    ConstantSizedAtomicBitsetTest() {}
+
+    virtual ~ConstantSizedAtomicBitsetTest() {}
+
+public:
+
+    static const uint16_t TEST_SIZE = 8;
+
+    using Bitset = Container::ConstantSizedAtomicBitset<ConstantSizedAtomicBitsetTest::TEST_SIZE>;
+};
+
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_anEmptyBitset_when_askedIfIsEmpty_then_returnsTrue) {
+    Bitset bitset;
+
+    auto empty = bitset.isEmpty();
+
+    ASSERT_TRUE(empty);
+}
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_aBitsetHoldingAnIndex_when_insertingItAgain_then_returnsFalse) {
+    Bitset bitset;
+    bitset.insert(3);
+
+    auto inserted = bitset.insert(3);
+
+    ASSERT_FALSE(inserted);
+    ASSERT_TRUE(bitset.contains(3));
+}
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_aBitsetHoldingAnIndex_when_removingIt_then_returnsTrueAndNoLongerHoldsIt) {
+    Bitset bitset;
+    bitset.insert(3);
+
+    auto removed = bitset.remove(3);
+
+    ASSERT_TRUE(removed);
+    ASSERT_FALSE(bitset.contains(3));
+    ASSERT_TRUE(bitset.isEmpty());
+}
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_anIndexNotHeld_when_removingIt_then_returnsFalse) {
+    Bitset bitset;
+    bitset.insert(1);
+
+    auto removed = bitset.remove(3);
+
+    ASSERT_FALSE(removed);
+    ASSERT_TRUE(bitset.contains(1));
+}
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_heldIndexesAfterTheStart_when_findingTheFirstFromStart_then_returnsTheNextHeldIndex) {
+    Bitset bitset;
+    bitset.insert(1);
+    bitset.insert(5);
+
+    auto first = bitset.findFirstFrom(2);
+
+    ASSERT_EQ(5u, first);
+}
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_noHeldIndexAfterTheStart_when_findingTheFirstFromStart_then_wrapsAround) {
+    Bitset bitset;
+    bitset.insert(1);
+
+    auto first = bitset.findFirstFrom(6);
+
+    ASSERT_EQ(1u, first);
+}
+
+TEST_F(ConstantSizedAtomicBitsetTest, given_anEmptyBitset_when_findingTheFirstHeldIndex_then_returnsTheSize) {
+    Bitset bitset;
+
+    auto first = bitset.findFirstFrom(0);
+
+    ASSERT_EQ(size_t(TEST_SIZE), first);
+}
+
+#endif //SENSORGATEWAY_CONSTANTSIZEDATOMICBITSETTEST_CPP
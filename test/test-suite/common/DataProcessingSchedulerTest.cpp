@@ -46,15 +46,16 @@ public:
     explicit MockInputBuffer(uint16_t numberOfConsumptionBeforeStop) :
             numberOfTimesToBeConsumedBeforeStop(numberOfConsumptionBeforeStop),
             data(DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps()),
-            numberOfCallsToConsumeNextData(0) {
+            numberOfConsumedData(0) {
     }
 
-    auto consumeNextDataFor(Consumer* consumer) -> SimpleMessage const& override {
-        numberOfCallsToConsumeNextData++;
-        if (hasBeenCalledExpectedNumberOfTimes()) {
+    auto consumeUpTo(Consumer* consumer, size_t maximumNumberOfData) -> DataFlow::DataBatch<SimpleMessage> override {
+        auto claimedData = SimpleBuffer::consumeUpTo(consumer, maximumNumberOfData);
+        numberOfConsumedData += claimedData.size();
+        if (!claimedData.isEmpty() && hasBeenCalledExpectedNumberOfTimes()) {
             consumptionGoalReached.set_value(true);
         }
-        return SimpleBuffer::consumeNextDataFor(consumer);
+        return claimedData;
     }
 
     void linkWith(Consumer* consumer) noexcept override {
@@ -63,7 +64,7 @@ public:
     }
 
     bool hasBeenCalledExpectedNumberOfTimes() const {
-        return numberOfCallsToConsumeNextData.load() == numberOfTimesToBeConsumedBeforeStop;
+        return numberOfConsumedData.load() == numberOfTimesToBeConsumedBeforeStop;
     };
 
     void waitConsumptionGoalToBeReached() const {
@@ -78,7 +79,7 @@ public:
 
 private:
     uint16_t const numberOfTimesToBeConsumedBeforeStop;
-    AtomicCounter numberOfCallsToConsumeNextData;
+    AtomicCounter numberOfConsumedData;
     SimpleMessage data;
     Consumer* linkedConsumer = nullptr;
     mutable BooleanPromise consumptionGoalReached;
@@ -285,4 +286,104 @@ TEST_F(DataProcessingSchedulerTest,
     ASSERT_TRUE(calledExpectedNumberOfTimes);
 }
 
+/**
+ * @note: Medium test
+ */
+TEST_F(DataProcessingSchedulerTest,
+       given_aBlockingWaitStrategy_when_dataIsWrittenToTheInputBuffer_then_wakesUpAndCallsTheDataSinkTheSameNumberOfTimes) {
+    using BlockingScheduler = DataFlow::DataProcessingScheduler<SimpleMessage, MockSink,
+            NUMBER_OF_CONCURRENT_INPUT_FOR_SENSOR_ACCESS_LINK_ELEMENTS, DataFlow::BlockingWaitStrategy>;
+    SimpleBuffer inputBuffer;
+    MockSink mockSink(ARBITRARY_NUMBER_OF_CALL_GOAL);
+    BlockingScheduler scheduler(&mockSink);
+    scheduler.linkWith(&inputBuffer);
+
+    for (auto k = 0; k < ARBITRARY_NUMBER_OF_CALL_GOAL; ++k) {
+        auto nativeData = DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps();
+        inputBuffer.write(std::move(nativeData));
+    }
+
+    mockSink.waitUntillReadMessageIsCalled();
+
+    scheduler.terminateAndJoin();
+
+    auto calledExpectedNumberOfTimes = mockSink.hasBeenCalledExpectedNumberOfTimes();
+    ASSERT_TRUE(calledExpectedNumberOfTimes);
+}
+
+/**
+ * @note: Medium test
+ */
+TEST_F(DataProcessingSchedulerTest,
+       given_aSchedulerExecutedByAnExecutor_when_dataIsWrittenToTheInputBuffer_then_callsTheDataSinkTheSameNumberOfTimes) {
+    DataFlow::WorkStealingExecutor executor(2);
+    SimpleBuffer inputBuffer;
+    MockSink mockSink(ARBITRARY_NUMBER_OF_CALL_GOAL);
+    SingleInputScheduler scheduler(&mockSink, &executor);
+    scheduler.linkWith(&inputBuffer);
+
+    for (auto k = 0; k < ARBITRARY_NUMBER_OF_CALL_GOAL; ++k) {
+        auto nativeData = DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps();
+        inputBuffer.write(std::move(nativeData));
+    }
+
+    mockSink.waitUntillReadMessageIsCalled();
+
+    scheduler.terminateAndJoin();
+
+    auto calledExpectedNumberOfTimes = mockSink.hasBeenCalledExpectedNumberOfTimes();
+    ASSERT_TRUE(calledExpectedNumberOfTimes);
+}
+
+TEST_F(DataProcessingSchedulerTest,
+       given_aTerminatedScheduler_when_unlinkFromInputs_then_itsInputBuffersNoLongerHaveItAsConsumer) {
+    SimpleBuffer inputBuffer;
+    MockSink mockSink(ARBITRARY_NUMBER_OF_CALL_GOAL);
+    SingleInputScheduler scheduler(&mockSink);
+    scheduler.linkWith(&inputBuffer);
+    scheduler.terminateAndJoin();
+
+    scheduler.unlinkFromInputs();
+
+    ASSERT_EQ(0, inputBuffer.fetchMetrics().numberOfConsumers);
+}
+
+TEST_F(DataProcessingSchedulerTest,
+       given_anUnlinkedScheduler_when_fetchMetrics_then_itHasNoInputAndIsNotLinkedAgain) {
+    SimpleBuffer inputBuffer;
+    MockSink mockSink(ARBITRARY_NUMBER_OF_CALL_GOAL);
+    SingleInputScheduler scheduler(&mockSink);
+    scheduler.linkWith(&inputBuffer);
+    scheduler.terminateAndJoin();
+    scheduler.unlinkFromInputs();
+
+    auto metrics = scheduler.fetchMetrics();
+
+    ASSERT_EQ(0, metrics.numberOfInputs);
+    ASSERT_EQ(0, inputBuffer.fetchMetrics().numberOfConsumers);
+}
+
+TEST_F(DataProcessingSchedulerTest,
+       given_aSchedulerQueriedForItsMetricsConcurrently_when_unlinkFromInputs_then_eachQuerySeesEitherItsInputOrNone) {
+    SimpleBuffer inputBuffer;
+    MockSink mockSink(ARBITRARY_NUMBER_OF_CALL_GOAL);
+    SingleInputScheduler scheduler(&mockSink);
+    scheduler.linkWith(&inputBuffer);
+    scheduler.terminateAndJoin();
+    auto allQueriesSawAValidNumberOfInputs = true;
+    std::thread metricsQuerier([&]() {
+        auto numberOfInputs = 1u;
+        while (numberOfInputs != 0) {
+            numberOfInputs = scheduler.fetchMetrics().numberOfInputs;
+            allQueriesSawAValidNumberOfInputs &= (numberOfInputs <= 1);
+        }
+    });
+
+    scheduler.unlinkFromInputs();
+    metricsQuerier.join();
+
+    ASSERT_TRUE(allQueriesSawAValidNumberOfInputs);
+    ASSERT_EQ(0, inputBuffer.fetchMetrics().numberOfConsumers);
+}
+
 #endif //SENSORGATEWAY_WORKSCHEDULERTEST_CPP
@@ -0,0 +1,111 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_INPUTSELECTIONPOLICIESTEST_CPP
+#define SENSORGATEWAY_INPUTSELECTIONPOLICIESTEST_CPP
+
+#include <gtest/gtest.h>
+#include "sensor-gateway/common/data-flow/InputSelectionPolicies.hpp"
+
+using DataFlow::InputIndex;
+using DataFlow::ReadyInputs;
+using DataFlow::MAXIMUM_NUMBER_OF_DATA_PER_BATCH;
+
+class InputSelectionPoliciesTest : public ::testing::Test {
+protected:
+
+    static size_t const NUMBER_OF_INPUTS = 3;
+    using Weights = DataFlow::InputWeights<NUMBER_OF_INPUTS>;
+
+    InputSelectionPoliciesTest() = default;
+
+    virtual ~InputSelectionPoliciesTest() = default;
+
+    static ReadyInputs const EVERY_INPUT_IS_READY = 0b111;
+
+    template<class POLICY>
+    static std::array<size_t, NUMBER_OF_INPUTS> countSelectionsOf(POLICY& policy, Weights const& weights,
+                                                                  size_t numberOfSelections, size_t batchSize) {
+        std::array<size_t, NUMBER_OF_INPUTS> numberOfSelectionsPerInput;
+        numberOfSelectionsPerInput.fill(0);
+        for (auto k = 0u; k < numberOfSelections; ++k) {
+            auto input = policy.selectNextInput(EVERY_INPUT_IS_READY, weights);
+            policy.accountFor(input, batchSize);
+            ++numberOfSelectionsPerInput[input];
+        }
+        return numberOfSelectionsPerInput;
+    }
+};
+
+TEST_F(InputSelectionPoliciesTest,
+       given_aRoundRobinPolicyAndBusyInputs_when_selectingInputs_then_eachInputIsSelectedForItsWeightInBatches) {
+    DataFlow::RoundRobinInputSelectionPolicy<NUMBER_OF_INPUTS> policy;
+    Weights weights = {{1, 2, 3}};
+
+    auto numberOfSelectionsPerInput = countSelectionsOf(policy, weights, 60, MAXIMUM_NUMBER_OF_DATA_PER_BATCH);
+
+    ASSERT_EQ(10u, numberOfSelectionsPerInput[0]);
+    ASSERT_EQ(20u, numberOfSelectionsPerInput[1]);
+    ASSERT_EQ(30u, numberOfSelectionsPerInput[2]);
+}
+
+TEST_F(InputSelectionPoliciesTest,
+       given_aRoundRobinPolicy_when_theSelectedInputIsNoLongerReady_then_selectsTheNextReadyInput) {
+    DataFlow::RoundRobinInputSelectionPolicy<NUMBER_OF_INPUTS> policy;
+    Weights weights = {{5, 5, 5}};
+    ReadyInputs const onlyFirstInputIsReady = 0b001;
+    ReadyInputs const onlyLastInputIsReady = 0b100;
+
+    auto firstInput = policy.selectNextInput(onlyFirstInputIsReady, weights);
+    policy.accountFor(firstInput, 1);
+    auto secondInput = policy.selectNextInput(onlyLastInputIsReady, weights);
+
+    ASSERT_EQ(0, firstInput);
+    ASSERT_EQ(2, secondInput);
+}
+
+TEST_F(InputSelectionPoliciesTest,
+       given_aStrictPriorityPolicy_when_severalInputsAreReady_then_alwaysSelectsTheReadyInputWithTheHighestWeight) {
+    DataFlow::StrictPriorityInputSelectionPolicy<NUMBER_OF_INPUTS> policy;
+    Weights weights = {{2, 0, 1}};
+    ReadyInputs const everyInputButTheFirstIsReady = 0b110;
+
+    auto numberOfSelectionsPerInput = countSelectionsOf(policy, weights, 10, MAXIMUM_NUMBER_OF_DATA_PER_BATCH);
+    auto inputSelectedWithoutTheFirst = policy.selectNextInput(everyInputButTheFirstIsReady, weights);
+
+    ASSERT_EQ(10u, numberOfSelectionsPerInput[0]);
+    ASSERT_EQ(2, inputSelectedWithoutTheFirst);
+}
+
+TEST_F(InputSelectionPoliciesTest,
+       given_aDeficitWeightedPolicyAndInputsWithDifferentBatchSizes_when_selectingInputs_then_consumedDataFollowTheWeights) {
+    DataFlow::DeficitWeightedInputSelectionPolicy<NUMBER_OF_INPUTS> policy;
+    Weights weights = {{1, 1, 2}};
+    std::array<size_t, NUMBER_OF_INPUTS> const batchSizes = {{MAXIMUM_NUMBER_OF_DATA_PER_BATCH, 4, 8}};
+    std::array<size_t, NUMBER_OF_INPUTS> numberOfConsumedData = {{0, 0, 0}};
+
+    auto const numberOfSelectionsPerRound = 1 + 8 + 8;
+    for (auto k = 0; k < 50 * numberOfSelectionsPerRound; ++k) {
+        auto input = policy.selectNextInput(EVERY_INPUT_IS_READY, weights);
+        policy.accountFor(input, batchSizes[input]);
+        numberOfConsumedData[input] += batchSizes[input];
+    }
+
+    ASSERT_EQ(numberOfConsumedData[0], numberOfConsumedData[1]);
+    ASSERT_EQ(2 * numberOfConsumedData[0], numberOfConsumedData[2]);
+}
+
+#endif //SENSORGATEWAY_INPUTSELECTIONPOLICIESTEST_CPP
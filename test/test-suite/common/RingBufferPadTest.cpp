@@ -40,48 +40,36 @@ protected:
 };
 
 
-TEST_F(RingBufferPadTest, given_aNewPad_when_fetchingNextPad_then_returnsSelf) {
-    auto initialPad = Pad();
-
-    auto testedNextPad = initialPad.next();
-
-    ASSERT_EQ(testedNextPad, &initialPad);
-}
-
-
-TEST_F(RingBufferPadTest, given_aNextPad_when_fetchingNextPad_then_returnsTheNextPad) {
-    auto initialPad = Pad();
+TEST_F(RingBufferPadTest, given_data_when_read_then_returnsData) {
     auto testedPad = Pad();
-    auto nextPadPointer = &initialPad;
-    testedPad.setNext(nextPadPointer);
+    auto data = DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps();
+    auto dataCopy = DataModel::SimpleMessage(data);
+    testedPad.write(std::move(data));
 
-    auto testedNextPad = testedPad.next();
+    auto readData = testedPad.read();
 
-    ASSERT_EQ(testedNextPad, nextPadPointer);
+    ASSERT_EQ(readData, dataCopy);
 }
 
-TEST_F(RingBufferPadTest, given_aNextPad_when_attemptingToSetANewNextPad_then_theNewNextPadIsNotAdded) {
-    auto initialPad = Pad();
-    auto ignoredPad = Pad();
-    auto testedPad = Pad();
-    auto nextPadPointer = &initialPad;
-    testedPad.setNext(nextPadPointer);
+TEST_F(RingBufferPadTest, given_aNewPad_when_read_then_returnsDefaultData) {
+    auto const testedPad = Pad();
 
-    testedPad.setNext(&ignoredPad);
+    auto readData = testedPad.read();
 
-    auto testedNextPad = testedPad.next();
-    ASSERT_EQ(testedNextPad, nextPadPointer);
+    ASSERT_EQ(readData, DataModel::SimpleMessage::returnDefaultData());
 }
 
-
-TEST_F(RingBufferPadTest, given_data_when_read_then_returnsData) {
+TEST_F(RingBufferPadTest, given_aWrittenPad_when_writingNewData_then_readReturnsTheNewData) {
     auto testedPad = Pad();
-    auto data = DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps();
-    testedPad.write(std::move(data));
+    auto oldData = DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps();
+    testedPad.write(std::move(oldData));
+    auto newData = DataTestUtil::createRandomSimpleMessageWithEmptyTimestamps();
+    auto newDataCopy = DataModel::SimpleMessage(newData);
 
-    auto readData = testedPad.read();
+    testedPad.write(std::move(newData));
 
-    ASSERT_EQ(readData, data);
+    auto readData = testedPad.read();
+    ASSERT_EQ(readData, newDataCopy);
 }
 
 #endif //SENSORGATEWAY_RINGBUFFERPADTEST_CPP
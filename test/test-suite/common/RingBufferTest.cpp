@@ -163,4 +163,457 @@ TEST_F(RingBufferTest, given_aFullBuffer_when_writesMoreThanOneData_then_overwri
     ASSERT_NE(secondDataCopy, lastWrittenData);
 }
 
+TEST_F(RingBufferTest, given_theMaximumNumberOfLinkedConsumers_when_linkingOneMoreConsumer_then_throwsAnException) {
+    SimpleBuffer simpleBuffer;
+    std::array<MockConsumerLink, 8> linkMocks;
+    for (auto& linkMock : linkMocks) {
+        simpleBuffer.linkWith(&linkMock);
+    }
+
+    auto extraLinkMock = MockConsumerLink();
+
+    ASSERT_THROW(simpleBuffer.linkWith(&extraLinkMock), std::runtime_error);
+}
+
+TEST_F(RingBufferTest, given_twoConsumersAtDifferentLocations_when_consumeNextDataForEach_then_eachConsumerReadsFromItsOwnLocation) {
+    SimpleBuffer simpleBuffer;
+    auto firstLinkMock = MockConsumerLink();
+    auto secondLinkMock = MockConsumerLink();
+    auto simpleDataOne = createRandomSimpleData();
+    auto simpleDataTwo = createRandomSimpleData();
+    auto simpleDataOneCopy = SimpleMessage(simpleDataOne);
+    auto simpleDataTwoCopy = SimpleMessage(simpleDataTwo);
+    simpleBuffer.write(std::move(simpleDataOne));
+    simpleBuffer.write(std::move(simpleDataTwo));
+    simpleBuffer.consumeNextDataFor(&firstLinkMock);
+
+    auto firstConsumedData = simpleBuffer.consumeNextDataFor(&firstLinkMock);
+    auto secondConsumedData = simpleBuffer.consumeNextDataFor(&secondLinkMock);
+
+    ASSERT_EQ(simpleDataTwoCopy, firstConsumedData);
+    ASSERT_EQ(simpleDataOneCopy, secondConsumedData);
+}
+
+TEST_F(RingBufferTest, given_aLinkedConsumerLappedByTheWriter_when_consumeNextDataFor_then_returnsTheOldestHeldDataAndCountsTheLostData) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    auto numberOfLappingData = 3;
+    for (auto i = 0; i < RING_BUFFER_SIZE + numberOfLappingData - 1; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+    auto oldestHeldData = createRandomSimpleData();
+    auto oldestHeldDataCopy = SimpleMessage(oldestHeldData);
+    simpleBuffer.write(std::move(oldestHeldData));
+    for (auto i = 0; i < RING_BUFFER_SIZE - 1; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+
+    auto consumedData = simpleBuffer.consumeNextDataFor(&linkMock);
+
+    ASSERT_EQ(oldestHeldDataCopy, consumedData);
+    ASSERT_EQ(RING_BUFFER_SIZE + numberOfLappingData - 1, simpleBuffer.fetchNumberOfLostDataFor(&linkMock));
+}
+
+TEST_F(RingBufferTest, given_aDropNewestPolicyAndAFullBuffer_when_writesOneNewData_then_keepsTheFirstDataAndCountsTheLostData) {
+    SimpleBuffer simpleBuffer(DataFlow::OverflowPolicy::DROP_NEWEST);
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    auto firstData = createRandomSimpleData();
+    auto firstDataCopy = SimpleMessage(firstData);
+    simpleBuffer.write(std::move(firstData));
+    for (auto i = 0; i < RING_BUFFER_SIZE; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+
+    auto consumedData = simpleBuffer.consumeNextDataFor(&linkMock);
+
+    ASSERT_EQ(firstDataCopy, consumedData);
+    ASSERT_EQ(1, simpleBuffer.fetchNumberOfLostDataFor(&linkMock));
+}
+
+TEST_F(RingBufferTest, given_aBlockProducerPolicyAndAFullBuffer_when_writesOneNewData_then_waitsForTheConsumerToFreeAPad) {
+    SimpleBuffer simpleBuffer(DataFlow::OverflowPolicy::BLOCK_PRODUCER);
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    auto firstData = createRandomSimpleData();
+    auto firstDataCopy = SimpleMessage(firstData);
+    simpleBuffer.write(std::move(firstData));
+    for (auto i = 0; i < RING_BUFFER_SIZE - 1; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+    AtomicFlag hasWritten(false);
+    auto blockedWriter = std::thread([&simpleBuffer, &hasWritten]() {
+        simpleBuffer.write(createRandomSimpleData());
+        hasWritten.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto hasWrittenBeforeConsumption = hasWritten.load();
+
+    auto consumedData = simpleBuffer.consumeNextDataFor(&linkMock);
+    blockedWriter.join();
+
+    ASSERT_FALSE(hasWrittenBeforeConsumption);
+    ASSERT_EQ(firstDataCopy, consumedData);
+    ASSERT_EQ(0, simpleBuffer.fetchNumberOfLostDataFor(&linkMock));
+}
+
+TEST_F(RingBufferTest, given_aClaimedData_when_releasingIt_then_theNextClaimReturnsTheNextData) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    auto simpleDataOne = createRandomSimpleData();
+    auto simpleDataTwo = createRandomSimpleData();
+    auto simpleDataOneCopy = SimpleMessage(simpleDataOne);
+    auto simpleDataTwoCopy = SimpleMessage(simpleDataTwo);
+    simpleBuffer.write(std::move(simpleDataOne));
+    simpleBuffer.write(std::move(simpleDataTwo));
+
+    auto firstClaimedData = SimpleMessage(simpleBuffer.claimNextDataFor(&linkMock));
+    simpleBuffer.releaseClaimedDataFor(&linkMock);
+    auto secondClaimedData = SimpleMessage(simpleBuffer.claimNextDataFor(&linkMock));
+    simpleBuffer.releaseClaimedDataFor(&linkMock);
+
+    ASSERT_EQ(simpleDataOneCopy, firstClaimedData);
+    ASSERT_EQ(simpleDataTwoCopy, secondClaimedData);
+}
+
+TEST_F(RingBufferTest, given_aClaimedDataAboutToBeOverwritten_when_writesOneNewData_then_waitsForTheDataToBeReleased) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    auto firstData = createRandomSimpleData();
+    auto firstDataCopy = SimpleMessage(firstData);
+    simpleBuffer.write(std::move(firstData));
+    for (auto i = 0; i < RING_BUFFER_SIZE - 1; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+    auto& claimedData = simpleBuffer.claimNextDataFor(&linkMock);
+    AtomicFlag hasWritten(false);
+    auto blockedWriter = std::thread([&simpleBuffer, &hasWritten]() {
+        simpleBuffer.write(createRandomSimpleData());
+        hasWritten.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto hasWrittenBeforeRelease = hasWritten.load();
+    auto claimedDataBeforeRelease = SimpleMessage(claimedData);
+
+    simpleBuffer.releaseClaimedDataFor(&linkMock);
+    blockedWriter.join();
+
+    ASSERT_FALSE(hasWrittenBeforeRelease);
+    ASSERT_EQ(firstDataCopy, claimedDataBeforeRelease);
+}
+
+TEST_F(RingBufferTest, given_moreDataThanTheMaximum_when_consumeUpToTheMaximum_then_returnsABatchOfTheMaximumNumberOfData) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    auto maximumNumberOfData = 2;
+    std::vector<SimpleMessage> writtenData;
+    for (auto i = 0; i < maximumNumberOfData + 1; ++i) {
+        auto data = createRandomSimpleData();
+        writtenData.push_back(data);
+        simpleBuffer.write(std::move(data));
+    }
+
+    auto batch = simpleBuffer.consumeUpTo(&linkMock, maximumNumberOfData);
+
+    ASSERT_EQ(maximumNumberOfData, batch.size());
+    ASSERT_EQ(writtenData[0], batch[0]);
+    ASSERT_EQ(writtenData[1], batch[1]);
+}
+
+TEST_F(RingBufferTest, given_dataWrappingAroundTheEndOfTheBuffer_when_consumeUpTo_then_returnsTheDataInWrittenOrder) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    auto numberOfWrappingData = 4;
+    for (auto i = 0; i < RING_BUFFER_SIZE - numberOfWrappingData / 2; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+        simpleBuffer.consumeNextDataFor(&linkMock);
+    }
+    std::vector<SimpleMessage> writtenData;
+    for (auto i = 0; i < numberOfWrappingData; ++i) {
+        auto data = createRandomSimpleData();
+        writtenData.push_back(data);
+        simpleBuffer.write(std::move(data));
+    }
+
+    auto batch = simpleBuffer.consumeUpTo(&linkMock, numberOfWrappingData);
+    std::vector<SimpleMessage> batchData;
+    batch.forEach([&batchData](SimpleMessage const& data) {
+        batchData.push_back(data);
+    });
+    simpleBuffer.releaseClaimedDataFor(&linkMock);
+
+    ASSERT_EQ(writtenData, batchData);
+}
+
+TEST_F(RingBufferTest, given_aLinkedConsumer_when_writeBatch_then_activatesConsumerAndPublishesTheDataInOrder) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    std::vector<SimpleMessage> dataToWrite;
+    for (auto i = 0; i < 3; ++i) {
+        dataToWrite.push_back(createRandomSimpleData());
+    }
+    auto dataToWriteCopy = std::vector<SimpleMessage>(dataToWrite);
+
+    simpleBuffer.writeBatch(dataToWrite.begin(), dataToWrite.end());
+
+    ASSERT_TRUE(linkMock.isActive());
+    auto batch = simpleBuffer.consumeUpTo(&linkMock, dataToWriteCopy.size());
+    ASSERT_EQ(dataToWriteCopy.size(), batch.size());
+    for (auto i = 0u; i < batch.size(); ++i) {
+        ASSERT_EQ(dataToWriteCopy[i], batch[i]);
+    }
+}
+
+TEST_F(RingBufferTest, given_aBufferOfGivenCapacity_when_writesOneMoreDataThanItsCapacity_then_overwritesTheFirstData) {
+    size_t const capacity = 4;
+    DataFlow::RingBuffer<SimpleMessage, capacity> simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    simpleBuffer.write(createRandomSimpleData());
+    auto secondData = createRandomSimpleData();
+    auto secondDataCopy = SimpleMessage(secondData);
+    simpleBuffer.write(std::move(secondData));
+    for (auto i = 0u; i < capacity - 1; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+
+    auto consumedData = simpleBuffer.consumeNextDataFor(&linkMock);
+
+    ASSERT_EQ(secondDataCopy, consumedData);
+    ASSERT_EQ(1, simpleBuffer.fetchNumberOfLostDataFor(&linkMock));
+}
+
+TEST_F(RingBufferTest, given_aConsumerLaggingByTheHighWatermark_when_askedIfCongested_then_returnsTrue) {
+    size_t const capacity = 8;
+    DataFlow::RingBuffer<SimpleMessage, capacity> simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    for (auto i = 0u; i < capacity * DataFlow::HIGH_WATERMARK_PERCENTAGE / 100; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+
+    auto congested = simpleBuffer.isCongested();
+
+    ASSERT_TRUE(congested);
+}
+
+TEST_F(RingBufferTest, given_aCongestedBuffer_when_itsConsumerCatchesUpUnderTheLowWatermark_then_isNoLongerCongested) {
+    size_t const capacity = 8;
+    DataFlow::RingBuffer<SimpleMessage, capacity> simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    for (auto i = 0u; i < capacity * DataFlow::HIGH_WATERMARK_PERCENTAGE / 100; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+    simpleBuffer.isCongested();
+
+    simpleBuffer.consumeNextDataFor(&linkMock);
+    auto congestedBetweenTheWatermarks = simpleBuffer.isCongested();
+    simpleBuffer.consumeUpTo(&linkMock, capacity);
+    simpleBuffer.releaseClaimedDataFor(&linkMock);
+    auto congestedOnceEmpty = simpleBuffer.isCongested();
+
+    ASSERT_TRUE(congestedBetweenTheWatermarks);
+    ASSERT_FALSE(congestedOnceEmpty);
+}
+
+TEST_F(RingBufferTest, given_aConsumerFallingBehind_when_askedIfCongested_then_returnsTrue) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    linkMock.fallBehind(true);
+
+    auto congested = simpleBuffer.isCongested();
+
+    ASSERT_TRUE(congested);
+}
+
+TEST_F(RingBufferTest,
+       given_twoConsumersThatConsumedDifferentAmountsOfData_when_fetchMetrics_then_returnsTheOccupancyAndTheLagOfEachConsumer) {
+    size_t const capacity = 8;
+    DataFlow::RingBuffer<SimpleMessage, capacity> simpleBuffer;
+    auto firstLinkMock = MockConsumerLink();
+    auto secondLinkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&firstLinkMock);
+    simpleBuffer.linkWith(&secondLinkMock);
+    for (auto i = 0u; i < 6; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+    simpleBuffer.consumeUpTo(&firstLinkMock, 2);
+    simpleBuffer.releaseClaimedDataFor(&firstLinkMock);
+    simpleBuffer.consumeUpTo(&secondLinkMock, 5);
+    simpleBuffer.releaseClaimedDataFor(&secondLinkMock);
+
+    auto metrics = simpleBuffer.fetchMetrics();
+
+    ASSERT_EQ(capacity, metrics.capacity);
+    ASSERT_EQ(DataFlow::SequenceNumber(6), metrics.numberOfWrittenData);
+    ASSERT_EQ(DataFlow::SequenceNumber(4), metrics.occupancy);
+    ASSERT_EQ(DataFlow::SequenceNumber(6), metrics.highestOccupancy);
+    ASSERT_EQ(2, metrics.numberOfConsumers);
+    ASSERT_EQ(DataFlow::SequenceNumber(4), metrics.consumers[0].lag);
+    ASSERT_EQ(DataFlow::SequenceNumber(1), metrics.consumers[1].lag);
+}
+
+TEST_F(RingBufferTest, given_aConsumerLaggingBehindTheWriter_when_fetchMetricsFor_then_returnsTheAgeOfItsOldestUnconsumedData) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    simpleBuffer.write(createRandomSimpleData());
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    simpleBuffer.write(createRandomSimpleData());
+
+    auto laggingMetrics = simpleBuffer.fetchMetricsFor(&linkMock);
+    simpleBuffer.consumeUpTo(&linkMock, 2);
+    simpleBuffer.releaseClaimedDataFor(&linkMock);
+    auto caughtUpMetrics = simpleBuffer.fetchMetricsFor(&linkMock);
+
+    ASSERT_EQ(DataFlow::SequenceNumber(2), laggingMetrics.lag);
+    ASSERT_GE(laggingMetrics.lagDuration.count(), 2e6);
+    ASSERT_GT(simpleBuffer.fetchMetrics().writeRate, 0);
+    ASSERT_EQ(DataFlow::SequenceNumber(0), caughtUpMetrics.lag);
+    ASSERT_EQ(0, caughtUpMetrics.lagDuration.count());
+}
+
+TEST_F(RingBufferTest, given_aConsumerLinkedFromSeveralThreadsAtOnce_when_linkWith_then_itGetsASingleCursor) {
+    auto const numberOfAttempts = 50u;
+    auto const numberOfLinkingThreads = 4u;
+    for (auto attempt = 0u; attempt < numberOfAttempts; ++attempt) {
+        SimpleBuffer simpleBuffer;
+        auto linkMock = MockConsumerLink();
+        AtomicFlag startLinking(false);
+        std::vector<std::thread> linkingThreads;
+        for (auto thread = 0u; thread < numberOfLinkingThreads; ++thread) {
+            linkingThreads.emplace_back([&simpleBuffer, &linkMock, &startLinking]() {
+                while (!startLinking.load()) {}
+                simpleBuffer.linkWith(&linkMock);
+            });
+        }
+
+        startLinking.store(true);
+        for (auto& linkingThread : linkingThreads) {
+            linkingThread.join();
+        }
+
+        ASSERT_EQ(1, simpleBuffer.fetchMetrics().numberOfConsumers);
+    }
+}
+
+TEST_F(RingBufferTest, given_aConsumerThatIsNotLinked_when_queryingItsMetrics_then_returnsZerosWithoutLinkingIt) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.write(createRandomSimpleData());
+
+    auto consumerMetrics = simpleBuffer.fetchMetricsFor(&linkMock);
+    auto numberOfLostData = simpleBuffer.fetchNumberOfLostDataFor(&linkMock);
+
+    ASSERT_EQ(DataFlow::SequenceNumber(0), consumerMetrics.lag);
+    ASSERT_EQ(DataFlow::SequenceNumber(0), numberOfLostData);
+    ASSERT_EQ(0, simpleBuffer.fetchMetrics().numberOfConsumers);
+}
+
+TEST_F(RingBufferTest, given_dataAlreadyWritten_when_aConsumerIsLinked_then_itStartsAtTheWriterSequenceAndIsActivated) {
+    SimpleBuffer simpleBuffer;
+    simpleBuffer.write(createRandomSimpleData());
+    simpleBuffer.write(createRandomSimpleData());
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    auto dataWrittenAfterTheLink = createRandomSimpleData();
+    auto dataWrittenAfterTheLinkCopy = SimpleMessage(dataWrittenAfterTheLink);
+    simpleBuffer.write(std::move(dataWrittenAfterTheLink));
+
+    auto consumedData = simpleBuffer.consumeNextDataFor(&linkMock);
+
+    ASSERT_EQ(dataWrittenAfterTheLinkCopy, consumedData);
+    ASSERT_EQ(0, simpleBuffer.fetchNumberOfLostDataFor(&linkMock));
+}
+
+TEST_F(RingBufferTest, given_anUnlinkedConsumer_when_write_then_theConsumerIsNotActivated) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+
+    simpleBuffer.unlink(&linkMock);
+    simpleBuffer.write(createRandomSimpleData());
+
+    ASSERT_FALSE(linkMock.isActive());
+    ASSERT_EQ(0, simpleBuffer.fetchMetrics().numberOfConsumers);
+}
+
+TEST_F(RingBufferTest, given_aLaggingConsumerThatIsUnlinked_when_write_then_theWriterNoLongerDropsDataBecauseOfIt) {
+    size_t const capacity = 4;
+    DataFlow::RingBuffer<SimpleMessage, capacity> simpleBuffer(DataFlow::OverflowPolicy::DROP_NEWEST);
+    auto laggingLinkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&laggingLinkMock);
+    for (auto i = 0u; i < capacity; ++i) {
+        simpleBuffer.write(createRandomSimpleData());
+    }
+
+    simpleBuffer.unlink(&laggingLinkMock);
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    auto dataWrittenOnceUnlinked = createRandomSimpleData();
+    auto dataWrittenOnceUnlinkedCopy = SimpleMessage(dataWrittenOnceUnlinked);
+    simpleBuffer.write(std::move(dataWrittenOnceUnlinked));
+
+    ASSERT_EQ(dataWrittenOnceUnlinkedCopy, simpleBuffer.consumeNextDataFor(&linkMock));
+    ASSERT_EQ(DataFlow::SequenceNumber(capacity + 1), simpleBuffer.fetchMetrics().numberOfWrittenData);
+}
+
+TEST_F(RingBufferTest,
+       given_aBlockProducerPolicyAndAConsumerLinkedOnItsFirstConsumptionAfterTheBufferWrapped_when_write_then_waitsForThatConsumer) {
+    size_t const capacity = 4;
+    DataFlow::RingBuffer<SimpleMessage, capacity> simpleBuffer(DataFlow::OverflowPolicy::BLOCK_PRODUCER);
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    std::vector<SimpleMessage> writtenData;
+    for (auto i = 0u; i < 2 * capacity; ++i) {
+        writtenData.push_back(createRandomSimpleData());
+        simpleBuffer.write(SimpleMessage(writtenData.back()));
+        simpleBuffer.consumeNextDataFor(&linkMock);
+    }
+    auto lateLinkMock = MockConsumerLink();
+    auto firstConsumedData = SimpleMessage(simpleBuffer.consumeNextDataFor(&lateLinkMock));
+    for (auto i = 0u; i < capacity; ++i) {
+        writtenData.push_back(createRandomSimpleData());
+    }
+    AtomicFlag hasWritten(false);
+    auto blockedWriter = std::thread([&simpleBuffer, &writtenData, &hasWritten]() {
+        for (auto i = 2 * capacity; i < writtenData.size(); ++i) {
+            simpleBuffer.write(SimpleMessage(writtenData[i]));
+        }
+        hasWritten.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto hasWrittenBeforeConsumption = hasWritten.load();
+
+    std::vector<SimpleMessage> consumedData = {firstConsumedData};
+    for (auto i = capacity + 2; i < 2 * capacity; ++i) {
+        consumedData.push_back(SimpleMessage(simpleBuffer.consumeNextDataFor(&lateLinkMock)));
+    }
+    blockedWriter.join();
+    for (auto i = 2 * capacity; i < writtenData.size(); ++i) {
+        consumedData.push_back(SimpleMessage(simpleBuffer.consumeNextDataFor(&lateLinkMock)));
+    }
+
+    ASSERT_FALSE(hasWrittenBeforeConsumption);
+    ASSERT_EQ(std::vector<SimpleMessage>(writtenData.begin() + capacity + 1, writtenData.end()), consumedData);
+    ASSERT_EQ(0, simpleBuffer.fetchNumberOfLostDataFor(&lateLinkMock));
+}
+
+TEST_F(RingBufferTest, given_theMaximumNumberOfConsumersOfWhichOneIsUnlinked_when_linkingAnotherConsumer_then_doesNotThrow) {
+    SimpleBuffer simpleBuffer;
+    std::array<MockConsumerLink, DataFlow::MAXIMUM_NUMBER_OF_CONSUMERS_PER_RING_BUFFER> linkMocks;
+    for (auto& linkMock : linkMocks) {
+        simpleBuffer.linkWith(&linkMock);
+    }
+    simpleBuffer.unlink(&linkMocks[3]);
+    auto linkMock = MockConsumerLink();
+
+    ASSERT_NO_THROW(simpleBuffer.linkWith(&linkMock));
+    ASSERT_THROW(simpleBuffer.linkWith(&linkMocks[3]), std::runtime_error);
+}
+
 #endif //SENSORGATEWAY_RINGBUFFERTEST_CPP
@@ -0,0 +1,116 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_SHAREDMEMORYDATASINKTEST_CPP
+#define SENSORGATEWAY_SHAREDMEMORYDATASINKTEST_CPP
+
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-flow/SharedMemoryDataSink.hpp"
+#include "sensor-gateway/common/data-structure/sensor/AWLStructures.h"
+#include "sensor-gateway/common/data-structure/spirit/SharedMemorySlots.hpp"
+#include "sensor-gateway/common/data-structure/spirit/SpiritStructures.h"
+
+using DataFlow::PixelId;
+using DataFlow::Track;
+
+class SharedMemoryDataSinkTest : public ::testing::Test {
+protected:
+
+    SharedMemoryDataSinkTest() :
+            segmentName("/sensor-gateway-sink-test-" + std::to_string(getpid())) {}
+
+    virtual ~SharedMemoryDataSinkTest() = default;
+
+    static size_t const CAPACITY = 4;
+
+    using Structures = Sensor::Spirit::Structures<
+            Sensor::AWL::Structures::AWLMessageDefinition,
+            Sensor::AWL::Structures::AWLRawDataDefinition,
+            Sensor::AWL::Structures::AWLCommandDefinition,
+            DataFlow::NumericEncoding::AWLTrackEncoding
+    >;
+    using Message = Structures::Message;
+    using RawData = Structures::RawData;
+
+    using SharedMessage = DataFlow::SharedSensorMessage<Message>;
+    using SharedRawData = DataFlow::SharedRawData<RawData>;
+
+    PixelId const SOME_PIXEL_ID = 3;
+    PixelId const SOME_OTHER_PIXEL_ID = 9;
+    Track const SOME_TRACK = Track(12, 50, 12.34, -0.5, 600.25, -3.2);
+    Track const SOME_OTHER_TRACK = Track(13, 90, 4.5, 0.25, 18.5, 1.75);
+
+    std::string const segmentName;
+};
+
+TEST_F(SharedMemoryDataSinkTest,
+       given_aSensorMessageConsumedBySharedMemoryDataSink_when_readingItsSlot_then_holdsTheIdsAndTheEncodedTracks) {
+    DataFlow::SharedMemoryDataSink<Message, SharedMessage, CAPACITY> sharedMemoryDataSink(segmentName);
+    DataFlow::SharedMemoryReader<SharedMessage, CAPACITY> reader(segmentName);
+    Message message(1234, 5, Message::Pixels());
+    message.addTrackToPixelWithId(SOME_PIXEL_ID, Track(SOME_TRACK));
+    message.addTrackToPixelWithId(SOME_PIXEL_ID, Track(SOME_OTHER_TRACK));
+    message.addTrackToPixelWithId(SOME_OTHER_PIXEL_ID, Track(SOME_OTHER_TRACK));
+
+    sharedMemoryDataSink.consume(std::move(message));
+
+    SharedMessage sharedMessage;
+    auto status = reader.readNext([&sharedMessage](SharedMessage const& slot) {
+        sharedMessage = slot;
+    });
+    ASSERT_EQ(decltype(reader)::READ, status);
+    ASSERT_EQ(DataFlow::MessageId(1234), sharedMessage.messageId);
+    ASSERT_EQ(DataFlow::SensorId(5), sharedMessage.sensorId);
+    auto const& pixel = sharedMessage.pixels[SOME_PIXEL_ID];
+    ASSERT_EQ(SOME_PIXEL_ID, pixel.id);
+    ASSERT_EQ(2, pixel.numberOfTracks);
+    ASSERT_EQ(SOME_TRACK, pixel.tracks[0].decode());
+    ASSERT_EQ(SOME_OTHER_TRACK, pixel.tracks[1].decode());
+    ASSERT_EQ(1, sharedMessage.pixels[SOME_OTHER_PIXEL_ID].numberOfTracks);
+    ASSERT_EQ(0, sharedMessage.pixels[0].numberOfTracks);
+}
+
+TEST_F(SharedMemoryDataSinkTest,
+       given_aRawDataConsumedBySharedMemoryDataSink_when_readingItsSlot_then_holdsTheSameContent) {
+    DataFlow::SharedMemoryDataSink<RawData, SharedRawData, CAPACITY> sharedMemoryDataSink(segmentName);
+    DataFlow::SharedMemoryReader<SharedRawData, CAPACITY> reader(segmentName);
+    RawData::Content content;
+    for (auto index = 0u; index < content.size(); ++index) {
+        content[index] = static_cast<RawData::Content::value_type>(index) - 10;
+    }
+
+    sharedMemoryDataSink.consume(RawData(content));
+
+    auto contentIsTheSame = false;
+    auto status = reader.readNext([&contentIsTheSame, &content](SharedRawData const& slot) {
+        contentIsTheSame = (slot.content == content);
+    });
+    ASSERT_EQ(decltype(reader)::READ, status);
+    ASSERT_TRUE(contentIsTheSame);
+}
+
+TEST_F(SharedMemoryDataSinkTest,
+       given_aSharedMemoryDataSink_when_aReaderAttaches_then_theSinkCountsIt) {
+    DataFlow::SharedMemoryDataSink<RawData, SharedRawData, CAPACITY> sharedMemoryDataSink(segmentName);
+    ASSERT_EQ(0, sharedMemoryDataSink.fetchNumberOfAttachedReaders());
+
+    DataFlow::SharedMemoryReader<SharedRawData, CAPACITY> reader(segmentName);
+
+    ASSERT_EQ(1, sharedMemoryDataSink.fetchNumberOfAttachedReaders());
+}
+
+#endif //SENSORGATEWAY_SHAREDMEMORYDATASINKTEST_CPP
@@ -0,0 +1,197 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_SHAREDMEMORYRINGBUFFERTEST_CPP
+#define SENSORGATEWAY_SHAREDMEMORYRINGBUFFERTEST_CPP
+
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <sys/wait.h>
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-flow/SharedMemoryRingBuffer.hpp"
+
+using DataFlow::SequenceNumber;
+
+class SharedMemoryRingBufferTest : public ::testing::Test {
+protected:
+
+    SharedMemoryRingBufferTest() :
+            segmentName("/sensor-gateway-test-" + std::to_string(getpid())) {}
+
+    virtual ~SharedMemoryRingBufferTest() = default;
+
+    static size_t const CAPACITY = 8;
+
+    struct Slot {
+        uint64_t number;
+        uint32_t values[4];
+    };
+
+    using SharedBuffer = DataFlow::SharedMemoryRingBuffer<Slot, CAPACITY>;
+    using SharedReader = DataFlow::SharedMemoryReader<Slot, CAPACITY>;
+
+    static Slot createSlotWith(uint64_t number) {
+        return {number, {uint32_t(number), uint32_t(number + 1), uint32_t(number + 2), uint32_t(number + 3)}};
+    }
+
+    std::string const segmentName;
+};
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aReaderAttachedToASharedMemoryRingBuffer_when_readNext_then_givesTheWrittenDataInOrder) {
+    SharedBuffer sharedBuffer(segmentName);
+    SharedReader reader(segmentName);
+    uint64_t const numberOfData = 5;
+    for (auto number = 0u; number < numberOfData; ++number) {
+        sharedBuffer.write(createSlotWith(number));
+    }
+
+    std::vector<uint64_t> readNumbers;
+    while (reader.readNext([&readNumbers](Slot const& slot) {
+        ASSERT_EQ(uint32_t(slot.number + 3), slot.values[3]);
+        readNumbers.push_back(slot.number);
+    }) == SharedReader::READ) {}
+
+    std::vector<uint64_t> expectedNumbers = {0, 1, 2, 3, 4};
+    ASSERT_EQ(expectedNumbers, readNumbers);
+    ASSERT_EQ(SequenceNumber(0), reader.fetchNumberOfLostData());
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aReaderLappedByTheWriter_when_readNext_then_skipsToTheOldestDataStillHeldAndCountsTheLostData) {
+    SharedBuffer sharedBuffer(segmentName);
+    SharedReader reader(segmentName);
+    uint64_t const numberOfLostData = 3;
+    for (auto number = 0u; number < CAPACITY + numberOfLostData; ++number) {
+        sharedBuffer.write(createSlotWith(number));
+    }
+
+    uint64_t firstReadNumber = 0;
+    auto status = reader.readNext([&firstReadNumber](Slot const& slot) {
+        firstReadNumber = slot.number;
+    });
+
+    ASSERT_EQ(SharedReader::READ, status);
+    ASSERT_EQ(numberOfLostData, firstReadNumber);
+    ASSERT_EQ(SequenceNumber(numberOfLostData), reader.fetchNumberOfLostData());
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aSharedMemoryRingBuffer_when_readersAttachAndDetach_then_theNumberOfAttachedReadersFollows) {
+    SharedBuffer sharedBuffer(segmentName);
+    {
+        SharedReader firstReader(segmentName);
+        SharedReader secondReader(segmentName);
+        ASSERT_EQ(2, sharedBuffer.fetchNumberOfAttachedReaders());
+    }
+
+    ASSERT_EQ(0, sharedBuffer.fetchNumberOfAttachedReaders());
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aReaderProcessThatDiedWithoutDetaching_when_readersAttach_then_itsCursorIsReclaimed) {
+    uint8_t const maximumNumberOfReaders =
+            DataFlow::SharedMemoryRingBufferLayout<Slot, CAPACITY>::MAXIMUM_NUMBER_OF_READERS;
+    SharedBuffer sharedBuffer(segmentName);
+    auto readerProcessId = fork();
+    if (readerProcessId == 0) {
+        new SharedReader(segmentName);
+        _exit(0);
+    }
+    waitpid(readerProcessId, nullptr, 0);
+
+    ASSERT_EQ(0, sharedBuffer.fetchNumberOfAttachedReaders());
+    std::vector<std::unique_ptr<SharedReader>> readers;
+    for (auto readerNumber = 0u; readerNumber < maximumNumberOfReaders; ++readerNumber) {
+        readers.emplace_back(new SharedReader(segmentName));
+    }
+    ASSERT_EQ(maximumNumberOfReaders, sharedBuffer.fetchNumberOfAttachedReaders());
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aReaderAttachedAfterSomeWrites_when_readNext_then_onlyGivesTheDataWrittenAfterTheAttachment) {
+    SharedBuffer sharedBuffer(segmentName);
+    sharedBuffer.write(createSlotWith(0));
+    SharedReader reader(segmentName);
+    sharedBuffer.write(createSlotWith(1));
+
+    uint64_t readNumber = 0;
+    auto firstStatus = reader.readNext([&readNumber](Slot const& slot) {
+        readNumber = slot.number;
+    });
+    auto secondStatus = reader.readNext([](Slot const&) {});
+
+    ASSERT_EQ(SharedReader::READ, firstStatus);
+    ASSERT_EQ(uint64_t(1), readNumber);
+    ASSERT_EQ(SharedReader::NO_DATA, secondStatus);
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aWriterLappingTheReaderDuringAVisit_when_readNext_then_theVisitedDataIsNotOverwritten) {
+    SharedBuffer sharedBuffer(segmentName);
+    SharedReader reader(segmentName);
+    auto const writtenSlot = createSlotWith(0);
+    sharedBuffer.write(writtenSlot);
+    auto visitedDataIsTheWrittenOne = false;
+
+    auto status = reader.readNext([&sharedBuffer, &writtenSlot, &visitedDataIsTheWrittenOne](Slot const& slot) {
+        for (auto number = 1u; number <= CAPACITY; ++number) {
+            sharedBuffer.write(createSlotWith(number));
+        }
+        visitedDataIsTheWrittenOne = (std::memcmp(&slot, &writtenSlot, sizeof(Slot)) == 0);
+    });
+
+    ASSERT_EQ(SharedReader::READ, status);
+    ASSERT_TRUE(visitedDataIsTheWrittenOne);
+    ASSERT_EQ(SequenceNumber(0), reader.fetchNumberOfLostData());
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_noSharedMemoryRingBufferWithTheName_when_attachingAReader_then_throwsARuntimeError) {
+    ASSERT_THROW(SharedReader reader(segmentName), std::runtime_error);
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aSegmentNotYetSizedByItsCreator_when_attachingAReader_then_throwsARuntimeError) {
+    auto unsizedFileDescriptor = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    close(unsizedFileDescriptor);
+
+    ASSERT_THROW(SharedReader reader(segmentName), std::runtime_error);
+
+    DataFlow::SharedMemorySegment::removeStale(segmentName);
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aSharedMemoryRingBufferAlreadyCreatedWithTheName_when_creatingAnother_then_throwsARuntimeError) {
+    SharedBuffer sharedBuffer(segmentName);
+
+    ASSERT_THROW(SharedBuffer otherSharedBuffer(segmentName), std::runtime_error);
+}
+
+TEST_F(SharedMemoryRingBufferTest,
+       given_aSegmentLeftByACrashedCreator_when_removingItAsStale_then_aSharedMemoryRingBufferCanBeCreated) {
+    auto staleFileDescriptor = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    close(staleFileDescriptor);
+    ASSERT_THROW(SharedBuffer sharedBuffer(segmentName), std::runtime_error);
+
+    DataFlow::SharedMemorySegment::removeStale(segmentName);
+
+    ASSERT_NO_THROW(SharedBuffer sharedBuffer(segmentName));
+}
+
+#endif //SENSORGATEWAY_SHAREDMEMORYRINGBUFFERTEST_CPP
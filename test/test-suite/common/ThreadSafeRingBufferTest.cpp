@@ -0,0 +1,144 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_THREADSAFERINGBUFFERTEST_CPP
+#define SENSORGATEWAY_THREADSAFERINGBUFFERTEST_CPP
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-flow/ThreadSafeRingBuffer.hpp"
+#include "test/utilities/data-model/DataModelFixture.h"
+#include "test/utilities/mock/ConsumerLinkMock.h"
+
+using DataModel::SimpleMessage;
+
+using MockConsumerLink = Mock::ConsumerLinkMock<SimpleMessage>;
+
+class ThreadSafeRingBufferTest : public ::testing::Test {
+protected:
+
+    ThreadSafeRingBufferTest() = default;
+
+    virtual ~ThreadSafeRingBufferTest() = default;
+
+    static size_t const CAPACITY = 16;
+    static uint8_t const NUMBER_OF_PRODUCERS = 4;
+    static uint16_t const NUMBER_OF_DATA_PER_PRODUCER = 2000;
+
+    using SimpleBuffer = DataFlow::ThreadSafeRingBuffer<SimpleMessage, CAPACITY>;
+
+    static SimpleMessage createDataOf(size_t producer, size_t dataNumber) {
+        SimpleMessage::Content content = {{std::to_string(producer), std::to_string(dataNumber)}};
+        return SimpleMessage(content, SimpleMessage::ServiceTimestamps());
+    }
+};
+
+/**
+ * @brief Activations come from every producer thread, the consumer of the test polls instead.
+ */
+class PollingConsumerLink : public DataFlow::ConsumerLink<SimpleMessage> {
+
+    using Buffer = DataFlow::AbstractRingBuffer<SimpleMessage>;
+
+public:
+
+    void linkWith(Buffer* buffer) override {
+        buffer->linkWith(this);
+    }
+
+    void activateFor(Buffer*) override {}
+
+    void deactivateFor(Buffer*) override {}
+};
+
+TEST_F(ThreadSafeRingBufferTest, given_aLinkedConsumer_when_writeBatch_then_publishesTheDataInOrder) {
+    SimpleBuffer simpleBuffer;
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    std::vector<SimpleMessage> dataToWrite = {createDataOf(0, 0), createDataOf(0, 1), createDataOf(0, 2)};
+    auto dataToWriteCopy = dataToWrite;
+
+    simpleBuffer.writeBatch(dataToWrite.begin(), dataToWrite.end());
+
+    ASSERT_TRUE(linkMock.isActive());
+    auto batch = simpleBuffer.consumeUpTo(&linkMock, dataToWriteCopy.size());
+    ASSERT_EQ(dataToWriteCopy.size(), batch.size());
+    for (auto i = 0u; i < batch.size(); ++i) {
+        ASSERT_EQ(dataToWriteCopy[i], batch[i]);
+    }
+}
+
+TEST_F(ThreadSafeRingBufferTest, given_aDropNewestBufferFullForItsConsumer_when_writesData_then_theDataIsCountedAsLost) {
+    SimpleBuffer simpleBuffer(DataFlow::OverflowPolicy::DROP_NEWEST);
+    auto linkMock = MockConsumerLink();
+    simpleBuffer.linkWith(&linkMock);
+    for (auto i = 0u; i < CAPACITY; ++i) {
+        simpleBuffer.write(createDataOf(0, i));
+    }
+
+    simpleBuffer.write(createDataOf(0, CAPACITY));
+
+    ASSERT_EQ(1, simpleBuffer.fetchNumberOfLostDataFor(&linkMock));
+    auto consumedData = simpleBuffer.consumeNextDataFor(&linkMock);
+    ASSERT_EQ(createDataOf(0, 0), consumedData);
+}
+
+TEST_F(ThreadSafeRingBufferTest,
+       given_severalProducersOnABlockingBuffer_when_theyWriteConcurrently_then_everyDataIsConsumedOnceInProducerOrder) {
+    SimpleBuffer simpleBuffer(DataFlow::OverflowPolicy::BLOCK_PRODUCER);
+    PollingConsumerLink consumer;
+    simpleBuffer.linkWith(&consumer);
+    std::vector<JoinableThread> producers;
+    producers.reserve(NUMBER_OF_PRODUCERS);
+    for (auto producer = 0u; producer < NUMBER_OF_PRODUCERS; ++producer) {
+        producers.emplace_back([&simpleBuffer, producer]() {
+            for (auto dataNumber = 0u; dataNumber < NUMBER_OF_DATA_PER_PRODUCER; ++dataNumber) {
+                simpleBuffer.write(createDataOf(producer, dataNumber));
+            }
+        });
+    }
+
+    std::array<size_t, NUMBER_OF_PRODUCERS> nextDataNumberOfProducers;
+    nextDataNumberOfProducers.fill(0);
+    auto numberOfConsumedData = 0u;
+    auto everyDataIsInProducerOrder = true;
+    while (numberOfConsumedData < NUMBER_OF_PRODUCERS * NUMBER_OF_DATA_PER_PRODUCER) {
+        auto batch = simpleBuffer.consumeUpTo(&consumer, CAPACITY);
+        batch.forEach([&](SimpleMessage const& data) {
+            size_t producer;
+            for (producer = 0; producer < NUMBER_OF_PRODUCERS; ++producer) {
+                if (data == createDataOf(producer, nextDataNumberOfProducers[producer])) {
+                    break;
+                }
+            }
+            everyDataIsInProducerOrder &= producer < NUMBER_OF_PRODUCERS;
+            if (producer < NUMBER_OF_PRODUCERS) {
+                ++nextDataNumberOfProducers[producer];
+            }
+            ++numberOfConsumedData;
+        });
+        simpleBuffer.releaseClaimedDataFor(&consumer);
+    }
+    for (auto& producer : producers) {
+        producer.exitSafely();
+    }
+
+    ASSERT_TRUE(everyDataIsInProducerOrder);
+    ASSERT_EQ(0, simpleBuffer.fetchNumberOfLostDataFor(&consumer));
+}
+
+#endif //SENSORGATEWAY_THREADSAFERINGBUFFERTEST_CPP
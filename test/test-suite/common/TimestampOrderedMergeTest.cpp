@@ -0,0 +1,203 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+#ifndef SENSORGATEWAY_TIMESTAMPORDEREDMERGETEST_CPP
+#define SENSORGATEWAY_TIMESTAMPORDEREDMERGETEST_CPP
+
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-flow/TimestampOrderedMerge.hpp"
+#include "sensor-gateway/common/data-structure/sensor/AWLStructures.h"
+#include "sensor-gateway/common/data-structure/spirit/SensorMessage.hpp"
+#include "test/utilities/mock/ArbitraryDataSinkMock.hpp"
+
+using DataModel::SimpleMessage;
+
+class TimestampOrderedMergeTest : public ::testing::Test {
+protected:
+
+    TimestampOrderedMergeTest() :
+            anHourAgo(HighResolutionClock::now() - std::chrono::hours(1)) {}
+
+    virtual ~TimestampOrderedMergeTest() = default;
+
+    struct SimpleMessageAcquisitionTime {
+        HighResolutionTimePoint operator()(SimpleMessage const& message) const noexcept {
+            return message.getGatewayTimestamps().getTimePoints()[0].timestamp;
+        }
+    };
+
+    static size_t const NUMBER_OF_INPUTS = 2;
+    static size_t const REORDER_WINDOW_SIZE = 4;
+
+    using SimpleMerge = DataFlow::TimestampOrderedMerge<SimpleMessage, NUMBER_OF_INPUTS, REORDER_WINDOW_SIZE,
+            DataFlow::RING_BUFFER_SIZE, SimpleMessageAcquisitionTime>;
+    using SinkMock = Mock::ArbitraryDataSinkMock<SimpleMessage>;
+    using SinkScheduler = DataFlow::DataProcessingScheduler<SimpleMessage, SinkMock, 1>;
+
+    SimpleMessage createMessageAcquiredAfter(int milliseconds) const {
+        return createMessageAcquiredAt(anHourAgo + std::chrono::milliseconds(milliseconds),
+                                       std::to_string(milliseconds));
+    }
+
+    static SimpleMessage createMessageAcquiredAt(HighResolutionTimePoint acquisitionTime, std::string name) {
+        SimpleMessage::ServiceTimestamps::TimePoints timePoints;
+        timePoints[0] = Metrics::TimePoint(acquisitionTime, Metrics::Locations::UNSPECIFIED);
+        SimpleMessage::Content content = {{std::move(name), ""}};
+        return SimpleMessage(content, SimpleMessage::ServiceTimestamps(timePoints, 1));
+    }
+
+    static std::vector<SimpleMessage> consumedDataOf(SinkMock const& sink) {
+        auto consumedData = sink.getConsumedData();
+        return std::vector<SimpleMessage>(consumedData.begin(), consumedData.end());
+    }
+
+    std::chrono::hours const NO_DEADLINE = std::chrono::hours(2);
+
+    HighResolutionTimePoint const anHourAgo;
+};
+
+TEST_F(TimestampOrderedMergeTest,
+       given_dataConsumedOutOfAcquisitionOrder_when_flush_then_producesTheDataInAcquisitionOrder) {
+    SimpleMerge merge(NO_DEADLINE);
+    SinkMock sink(3);
+    SinkScheduler sinkScheduler(&sink);
+    merge.linkConsumer(&sinkScheduler);
+    merge.consume(createMessageAcquiredAfter(20));
+    merge.consume(createMessageAcquiredAfter(0));
+    merge.consume(createMessageAcquiredAfter(10));
+
+    merge.terminateAndJoin();
+    sink.waitConsumptionToBeReached();
+    sinkScheduler.terminateAndJoin();
+
+    auto consumedData = consumedDataOf(sink);
+    ASSERT_EQ(createMessageAcquiredAfter(0), consumedData[0]);
+    ASSERT_EQ(createMessageAcquiredAfter(10), consumedData[1]);
+    ASSERT_EQ(createMessageAcquiredAfter(20), consumedData[2]);
+    ASSERT_EQ(DataFlow::SequenceNumber(0), merge.fetchNumberOfOutOfOrderData());
+}
+
+TEST_F(TimestampOrderedMergeTest,
+       given_aFullReorderWindow_when_consume_then_producesTheEarliestDataWithoutWaitingForTheDeadline) {
+    SimpleMerge merge(NO_DEADLINE);
+    SinkMock sink(1);
+    SinkScheduler sinkScheduler(&sink);
+    merge.linkConsumer(&sinkScheduler);
+    for (auto milliseconds : {40, 10, 30, 20}) {
+        merge.consume(createMessageAcquiredAfter(milliseconds));
+    }
+
+    merge.consume(createMessageAcquiredAfter(50));
+    sink.waitConsumptionToBeReached();
+
+    sinkScheduler.terminateAndJoin();
+    merge.terminateAndJoin();
+
+    auto consumedData = consumedDataOf(sink);
+    ASSERT_EQ(createMessageAcquiredAfter(10), consumedData[0]);
+}
+
+TEST_F(TimestampOrderedMergeTest,
+       given_inputsThatStopProducing_when_theLatencyDeadlineExpires_then_theHeldDataAreProducedWithoutAFlush) {
+    auto const latencyDeadline = std::chrono::milliseconds(20);
+    SimpleMerge merge(latencyDeadline);
+    SinkMock sink(2);
+    SinkScheduler sinkScheduler(&sink);
+    merge.linkConsumer(&sinkScheduler);
+    DataFlow::DataSource<SimpleMessage> source;
+    merge.linkInput(&source);
+    auto now = HighResolutionClock::now();
+    source.produce(createMessageAcquiredAt(now + std::chrono::milliseconds(1), "second"));
+    source.produce(createMessageAcquiredAt(now, "first"));
+
+    sink.waitConsumptionToBeReached();
+
+    auto consumedData = consumedDataOf(sink);
+    ASSERT_TRUE(HighResolutionClock::now() - now >= latencyDeadline);
+    ASSERT_EQ(createMessageAcquiredAt(now, "first"), consumedData[0]);
+    ASSERT_EQ(createMessageAcquiredAt(now + std::chrono::milliseconds(1), "second"), consumedData[1]);
+    merge.terminateAndJoin();
+    sinkScheduler.terminateAndJoin();
+}
+
+TEST_F(TimestampOrderedMergeTest,
+       given_aDataAcquiredBeforeAnAlreadyProducedOne_when_itReachesTheMerge_then_isProducedAndCountedAsOutOfOrder) {
+    SimpleMerge merge(std::chrono::hours(0));
+    merge.consume(createMessageAcquiredAfter(10));
+
+    merge.consume(createMessageAcquiredAfter(0));
+    merge.terminateAndJoin();
+
+    ASSERT_EQ(DataFlow::SequenceNumber(1), merge.fetchNumberOfOutOfOrderData());
+}
+
+TEST_F(TimestampOrderedMergeTest,
+       given_twoLinkedInputSources_when_theyProduceData_then_everyDataIsMergedInTheSingleOutput) {
+    uint8_t const numberOfDataPerSource = 10;
+    SimpleMerge merge(std::chrono::milliseconds(0));
+    SinkMock sink(2 * numberOfDataPerSource);
+    SinkScheduler sinkScheduler(&sink);
+    merge.linkConsumer(&sinkScheduler);
+    DataFlow::DataSource<SimpleMessage> firstSource;
+    DataFlow::DataSource<SimpleMessage> secondSource;
+    merge.linkInput(&firstSource);
+    merge.linkInput(&secondSource);
+
+    for (auto i = 0; i < numberOfDataPerSource; ++i) {
+        firstSource.produce(createMessageAcquiredAfter(2 * i));
+        secondSource.produce(createMessageAcquiredAfter(2 * i + 1));
+    }
+    sink.waitConsumptionToBeReached();
+
+    merge.terminateAndJoin();
+    sinkScheduler.terminateAndJoin();
+    ASSERT_EQ(2 * numberOfDataPerSource, sink.getNumberOfConsumptions());
+}
+
+TEST_F(TimestampOrderedMergeTest,
+       given_sensorMessagesConsumedOutOfAcquisitionOrder_when_flush_then_producesThemInTimestampOrder) {
+    using SensorMessage = DataFlow::SensorMessage<Sensor::AWL::Structures::AWLMessageDefinition>;
+    using SensorMessageMerge = DataFlow::TimestampOrderedMerge<SensorMessage, 1>;
+    using SensorMessageSinkMock = Mock::ArbitraryDataSinkMock<SensorMessage>;
+    using SensorMessageSinkScheduler = DataFlow::DataProcessingScheduler<SensorMessage, SensorMessageSinkMock, 1>;
+    DataFlow::MessageId const FIRST_ACQUIRED_MESSAGE_ID = 1;
+    DataFlow::MessageId const SECOND_ACQUIRED_MESSAGE_ID = 2;
+    auto firstAcquiredMessage = SensorMessage(FIRST_ACQUIRED_MESSAGE_ID, 0, SensorMessage::Pixels());
+    firstAcquiredMessage.addTimePointForGatewayWithLocation(Metrics::Locations::UNSPECIFIED);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto secondAcquiredMessage = SensorMessage(SECOND_ACQUIRED_MESSAGE_ID, 0, SensorMessage::Pixels());
+    secondAcquiredMessage.addTimePointForGatewayWithLocation(Metrics::Locations::UNSPECIFIED);
+    SensorMessageMerge merge(NO_DEADLINE);
+    SensorMessageSinkMock sink(2);
+    SensorMessageSinkScheduler sinkScheduler(&sink);
+    merge.linkConsumer(&sinkScheduler);
+    DataFlow::DataSource<SensorMessage> source;
+    merge.linkInput(&source);
+
+    source.produce(std::move(secondAcquiredMessage));
+    source.produce(std::move(firstAcquiredMessage));
+    merge.terminateAndJoin();
+    sink.waitConsumptionToBeReached();
+    sinkScheduler.terminateAndJoin();
+
+    auto consumedData = sink.getConsumedData();
+    ASSERT_EQ(FIRST_ACQUIRED_MESSAGE_ID, consumedData.front().messageId);
+    ASSERT_EQ(SECOND_ACQUIRED_MESSAGE_ID, consumedData.back().messageId);
+    ASSERT_EQ(DataFlow::SequenceNumber(0), merge.fetchNumberOfOutOfOrderData());
+}
+
+#endif //SENSORGATEWAY_TIMESTAMPORDEREDMERGETEST_CPP
@@ -0,0 +1,91 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_WORKSTEALINGEXECUTORTEST_CPP
+#define SENSORGATEWAY_WORKSTEALINGEXECUTORTEST_CPP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include "sensor-gateway/common/data-flow/WorkStealingExecutor.hpp"
+
+class WorkStealingExecutorTest : public ::testing::Test {
+protected:
+
+    WorkStealingExecutorTest() = default;
+
+    virtual ~WorkStealingExecutorTest() = default;
+
+    static size_t const NUMBER_OF_WORKERS = 3;
+    static uint16_t const ARBITRARY_NUMBER_OF_EXECUTIONS = 500;
+};
+
+class CountingTask : public DataFlow::ExecutorTask {
+public:
+    explicit CountingTask(DataFlow::WorkStealingExecutor* executor, uint16_t numberOfReschedules) :
+            executor(executor),
+            numberOfReschedules(numberOfReschedules),
+            numberOfExecutions(0) {
+    }
+
+    void execute() override {
+        auto executionNumber = ++numberOfExecutions;
+        if (executionNumber <= numberOfReschedules) {
+            executor->schedule(this);
+        }
+    }
+
+    uint16_t getNumberOfExecutions() const noexcept {
+        return numberOfExecutions.load();
+    }
+
+private:
+    DataFlow::WorkStealingExecutor* executor;
+    uint16_t const numberOfReschedules;
+    std::atomic<uint16_t> numberOfExecutions;
+};
+
+TEST_F(WorkStealingExecutorTest, given_scheduledTasks_when_terminateAndJoin_then_everyTaskHasBeenExecutedOnce) {
+    DataFlow::WorkStealingExecutor executor(NUMBER_OF_WORKERS);
+    std::vector<std::unique_ptr<CountingTask>> tasks;
+    for (auto i = 0; i < ARBITRARY_NUMBER_OF_EXECUTIONS; ++i) {
+        tasks.emplace_back(new CountingTask(&executor, 0));
+        executor.schedule(tasks.back().get());
+    }
+
+    executor.terminateAndJoin();
+
+    for (auto const& task : tasks) {
+        ASSERT_EQ(1, task->getNumberOfExecutions());
+    }
+}
+
+TEST_F(WorkStealingExecutorTest, given_aTaskSchedulingItselfFromAWorker_when_terminateAndJoin_then_everyExecutionHasHappened) {
+    DataFlow::WorkStealingExecutor executor(NUMBER_OF_WORKERS);
+    CountingTask task(&executor, ARBITRARY_NUMBER_OF_EXECUTIONS);
+
+    executor.schedule(&task);
+    while (task.getNumberOfExecutions() <= ARBITRARY_NUMBER_OF_EXECUTIONS) {
+        std::this_thread::yield();
+    }
+    executor.terminateAndJoin();
+
+    ASSERT_EQ(ARBITRARY_NUMBER_OF_EXECUTIONS + 1, task.getNumberOfExecutions());
+}
+
+#endif //SENSORGATEWAY_WORKSTEALINGEXECUTORTEST_CPP
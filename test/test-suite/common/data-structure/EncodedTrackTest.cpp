@@ -0,0 +1,89 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_ENCODEDTRACKTEST_CPP
+#define SENSORGATEWAY_ENCODEDTRACKTEST_CPP
+
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-structure/spirit/EncodedTrack.hpp"
+
+using DataFlow::Track;
+
+namespace NumericEncoding = DataFlow::NumericEncoding;
+
+class EncodedTrackTest : public ::testing::Test {
+protected:
+
+    EncodedTrackTest() = default;
+
+    virtual ~EncodedTrackTest() = default;
+
+    Track const SOME_TRACK = Track(14286, 12, -20.5, 1.5, 105.27, -3.04);
+};
+
+TEST_F(EncodedTrackTest, given_theCenti16Encoding_when_encodingATrack_then_theEncodedTrackTakesTwelveBytes) {
+    auto encodedTrack = DataFlow::EncodedTrack<NumericEncoding::Centi16>::encode(SOME_TRACK);
+
+    ASSERT_EQ(12u, sizeof(encodedTrack));
+}
+
+TEST_F(EncodedTrackTest, given_aTrackEncodedInDoublePrecision_when_decodingIt_then_returnsTheSameTrack) {
+    auto encodedTrack = DataFlow::EncodedTrack<NumericEncoding::DoublePrecision>::encode(SOME_TRACK);
+
+    ASSERT_EQ(SOME_TRACK, encodedTrack.decode());
+}
+
+TEST_F(EncodedTrackTest, given_aValueOutOfTheRangeOfAFixedPointEncoding_when_encodingIt_then_saturates) {
+    auto tooFarDistance = 1000.0;
+    auto tooNegativeSpeed = -1000.0;
+
+    ASSERT_EQ(std::numeric_limits<int16_t>::max(), NumericEncoding::Centi16::encode(tooFarDistance));
+    ASSERT_EQ(std::numeric_limits<int16_t>::min(), NumericEncoding::Centi16::encode(tooNegativeSpeed));
+}
+
+TEST_F(EncodedTrackTest, given_thePerSensorEncodings_when_encodingATrack_then_theEncodedTrackTakesTwelveBytes) {
+    auto awlTrack = DataFlow::EncodedTrack<NumericEncoding::AWLTrackEncoding>::encode(SOME_TRACK);
+    auto guardianTrack = DataFlow::EncodedTrack<NumericEncoding::GuardianTrackEncoding>::encode(SOME_TRACK);
+
+    ASSERT_EQ(12u, sizeof(awlTrack));
+    ASSERT_EQ(12u, sizeof(guardianTrack));
+}
+
+TEST_F(EncodedTrackTest, given_aTrackWithRawGuardianMagnitudes_when_encodingAndDecodingIt_then_returnsTheSameTrack) {
+    auto guardianTrack = Track(14286, 99, 60000, -32000, 50000, 31000);
+
+    auto encodedTrack = DataFlow::EncodedTrack<NumericEncoding::GuardianTrackEncoding>::encode(guardianTrack);
+
+    ASSERT_EQ(guardianTrack, encodedTrack.decode());
+}
+
+TEST_F(EncodedTrackTest, given_anAWLTrackFartherThanTheSignedRange_when_encodingAndDecodingIt_then_keepsItsDistance) {
+    auto farAWLTrack = Track(14286, 12, -20.5, 1.5, 600.25, -3.04);
+
+    auto encodedTrack = DataFlow::EncodedTrack<NumericEncoding::AWLTrackEncoding>::encode(farAWLTrack);
+
+    ASSERT_EQ(farAWLTrack, encodedTrack.decode());
+}
+
+TEST_F(EncodedTrackTest, given_aNegativeValue_when_encodingItAsUnsigned_then_saturatesToZero) {
+    auto negativeIntensity = -5.0;
+
+    ASSERT_EQ(0u, NumericEncoding::UnsignedUnit16::encode(negativeIntensity));
+}
+
+#endif //SENSORGATEWAY_ENCODEDTRACKTEST_CPP
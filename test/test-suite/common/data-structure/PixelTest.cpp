@@ -117,5 +117,27 @@ TEST_F(PixelTest,
     ASSERT_TRUE(tracksAreNotEqual);
 }
 
+TEST_F(PixelTest,
+       given_twoPixelsThatOnlyDifferPastTheirPopulatedTracks_when_checkingIfThePixelsAreEqual_then_returnsTrue) {
+    auto firstPixel = Pixel(SOME_ID, SOME_TRACKS_ARRAY, SOME_CURRENT_NUMBER_OF_TRACKS);
+    auto secondPixel = Pixel(SOME_ID, SOME_OTHER_TRACKS_ARRAY, SOME_CURRENT_NUMBER_OF_TRACKS);
+
+    auto tracksAreEqual = (firstPixel == secondPixel);
+    auto tracksAreNotEqual = (firstPixel != secondPixel);
+
+    ASSERT_TRUE(tracksAreEqual);
+    ASSERT_FALSE(tracksAreNotEqual);
+}
+
+TEST_F(PixelTest,
+       given_aPixelWithMoreTracksThanAnotherPixel_when_assigningTheOtherPixelToIt_then_thePixelsAreEqual) {
+    auto pixel = Pixel(SOME_ID, SOME_OTHER_TRACKS_ARRAY, SOME_OTHER_CURRENT_NUMBER_OF_TRACKS);
+    auto otherPixel = Pixel(SOME_OTHER_ID, SOME_TRACKS_ARRAY, SOME_CURRENT_NUMBER_OF_TRACKS);
+
+    pixel = otherPixel;
+
+    ASSERT_EQ(otherPixel, pixel);
+    ASSERT_EQ(Track::returnDefaultData(), pixel.getTracks()->at(SOME_CURRENT_NUMBER_OF_TRACKS));
+}
 
 #endif //SENSORGATEWAY_PIXELTEST_CPP
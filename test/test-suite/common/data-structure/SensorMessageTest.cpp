@@ -38,7 +38,7 @@ TEST_F(SensorMessageTest,
 
     sensorMessage.addTrackToPixelWithId(SOME_PIXEL_ID, std::move(track));
 
-    auto actualAddedTrack = sensorMessage.getPixels()->at(SOME_PIXEL_ID).getTracks()->at(trackPosition);
+    auto actualAddedTrack = sensorMessage.holdPixels()->at(SOME_PIXEL_ID).getTracks()->at(trackPosition);
     ASSERT_EQ(expectedAddedTrack, actualAddedTrack);
 }
 
@@ -91,4 +91,65 @@ TEST_F(SensorMessageTest,
     ASSERT_TRUE(sensorMessagesAreNotEqual);
 }
 
+TEST_F(SensorMessageTest, given_aSensorMessage_when_movingIt_then_theMovedToSensorMessageHoldsTheSamePixels) {
+    auto sensorMessage = SensorMessage(SOME_MESSAGE_ID, SOME_SENSOR_ID, SOME_PIXELS_ARRAY);
+    auto pixelsBeforeMove = &sensorMessage.readPixels();
+
+    auto movedSensorMessage = SensorMessage(std::move(sensorMessage));
+
+    ASSERT_EQ(pixelsBeforeMove, &movedSensorMessage.readPixels());
+    ASSERT_EQ(SensorMessage(SOME_MESSAGE_ID, SOME_SENSOR_ID, SOME_PIXELS_ARRAY), movedSensorMessage);
+}
+
+TEST_F(SensorMessageTest,
+       given_aMovedFromSensorMessage_when_readingItsPixels_then_readsTheDefaultPixelsWithoutAcquiringABlock) {
+    auto sensorMessage = SensorMessage(SOME_MESSAGE_ID, SOME_SENSOR_ID, SOME_PIXELS_ARRAY);
+    auto movedSensorMessage = SensorMessage(std::move(sensorMessage));
+    auto const& defaultPixels = DataFlow::Defaults::DEFAULT_PIXELS_ARRAY<Sensor::AWL::Structures::AWLMessageDefinition>;
+
+    auto const& readPixels = sensorMessage.readPixels();
+    auto frame = SensorMessage::Frame();
+    sensorMessage.compactInto(frame);
+    auto const& pixelsReadAgain = sensorMessage.readPixels();
+
+    ASSERT_EQ(&defaultPixels, &readPixels);
+    ASSERT_EQ(&defaultPixels, &pixelsReadAgain);
+    ASSERT_NE(&defaultPixels, sensorMessage.holdPixels());
+}
+
+TEST_F(SensorMessageTest,
+       given_aMovedFromSensorMessage_when_copyingIt_then_theCopyReadsTheDefaultPixelsWithoutAcquiringABlock) {
+    auto sensorMessage = SensorMessage(SOME_MESSAGE_ID, SOME_SENSOR_ID, SOME_PIXELS_ARRAY);
+    auto movedSensorMessage = SensorMessage(std::move(sensorMessage));
+    auto const& defaultPixels = DataFlow::Defaults::DEFAULT_PIXELS_ARRAY<Sensor::AWL::Structures::AWLMessageDefinition>;
+
+    auto copiedSensorMessage = SensorMessage(sensorMessage);
+
+    ASSERT_EQ(&defaultPixels, &copiedSensorMessage.readPixels());
+}
+
+TEST_F(SensorMessageTest, given_aMovedFromSensorMessage_when_checkingIfItEqualsTheDefaultSensorMessage_then_returnsTrue) {
+    auto sensorMessage = SensorMessage(SOME_MESSAGE_ID, SOME_SENSOR_ID, SOME_PIXELS_ARRAY);
+    auto movedSensorMessage = SensorMessage(std::move(sensorMessage));
+
+    auto movedFromSensorMessageIsDefault = (sensorMessage == SensorMessage::returnDefaultData());
+
+    ASSERT_TRUE(movedFromSensorMessageIsDefault);
+}
+
+TEST_F(SensorMessageTest, given_aTimeTrackedSensorMessage_when_copyingAndMovingIt_then_theTimePointsAreCarriedAlong) {
+    auto sensorMessage = SensorMessage(SOME_MESSAGE_ID, SOME_SENSOR_ID, SOME_PIXELS_ARRAY);
+    sensorMessage.addTimePointForGatewayWithLocation(Metrics::Locations::UNSPECIFIED);
+    auto expectedGatewayTimestamps = sensorMessage.getGatewayTimestamps();
+
+    auto copiedSensorMessage = SensorMessage(sensorMessage);
+    auto movedSensorMessage = SensorMessage(std::move(sensorMessage));
+    auto assignedSensorMessage = SensorMessage::returnDefaultData();
+    assignedSensorMessage = copiedSensorMessage;
+
+    ASSERT_EQ(expectedGatewayTimestamps, copiedSensorMessage.getGatewayTimestamps());
+    ASSERT_EQ(expectedGatewayTimestamps, movedSensorMessage.getGatewayTimestamps());
+    ASSERT_EQ(expectedGatewayTimestamps, assignedSensorMessage.getGatewayTimestamps());
+}
+
 #endif //SENSORGATEWAY_FRAMETEST_H
@@ -13,14 +13,13 @@ protected:
 
     static size_t const NUMBER_OF_TIME_POINTS = 19;
 
-    std::array<std::string, NUMBER_OF_TIME_POINTS> LOCATIONS;
+    std::array<Metrics::LocationId, NUMBER_OF_TIME_POINTS> LOCATIONS;
 
     using ServiceTimestamps = Metrics::ServiceTimestamps<NUMBER_OF_TIME_POINTS>;
 
     void SetUp() override {
-        static auto const LOCATION_STRING_LENGTH = 99;
         for (int locationIndex = 0; locationIndex < NUMBER_OF_TIME_POINTS; ++locationIndex) {
-            LOCATIONS[locationIndex] = TestFunctions::DataTestUtil::createRandomStringOfLength(LOCATION_STRING_LENGTH);
+            LOCATIONS[locationIndex] = static_cast<Metrics::LocationId>(NUMBER_OF_TIME_POINTS - locationIndex);
         }
     }
 
@@ -100,6 +99,17 @@ TEST_F(ServiceTimestampsTest,
     ASSERT_TRUE(Assert::firstOneComesBeforeTheSecondOne(firstTimestamp, secondTimestamp));
 }
 
+TEST_F(ServiceTimestampsTest,
+       given_aTimePointAddedForARegisteredLocation_when_fetchLocationName_then_returnsTheNameOfTheLocation) {
+    ServiceTimestamps serviceTimestamps;
+    serviceTimestamps.addTimePointForLocation(Metrics::Locations::SERVER_COMMUNICATOR_SENDING);
+
+    auto timePoint = serviceTimestamps.getTimePoints()[0];
+    auto actualLocationName = timePoint.fetchLocationName();
+
+    ASSERT_EQ(Metrics::LocationNames::SERVER_COMMUNICATOR_SENDING, actualLocationName);
+}
+
 TEST_F(ServiceTimestampsTest,
        given_aFullCapacityServiceTimestamps_when_addATimePoint_then_throwsAnException) {
     ServiceTimestamps serviceTimestamps;
@@ -0,0 +1,124 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_SPARSEFRAMETEST_CPP
+#define SENSORGATEWAY_SPARSEFRAMETEST_CPP
+
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-structure/sensor/AWLStructures.h"
+#include "sensor-gateway/common/data-structure/spirit/SensorMessage.hpp"
+
+using SensorMessage = typename DataFlow::SensorMessage<Sensor::AWL::Structures::AWLMessageDefinition>;
+using Frame = SensorMessage::Frame;
+using DataFlow::Track;
+using DataFlow::PixelId;
+
+class SparseFrameTest : public ::testing::Test {
+protected:
+
+    SparseFrameTest() = default;
+
+    virtual ~SparseFrameTest() = default;
+
+    SensorMessage createSensorMessageWithAFewTracks() const {
+        SensorMessage sensorMessage;
+        auto firstTrack = Track(SOME_TRACK);
+        auto secondTrack = Track(SOME_OTHER_TRACK);
+        auto thirdTrack = Track(SOME_OTHER_TRACK);
+        sensorMessage.addTrackToPixelWithId(SOME_OTHER_PIXEL_ID, std::move(firstTrack));
+        sensorMessage.addTrackToPixelWithId(SOME_PIXEL_ID, std::move(secondTrack));
+        sensorMessage.addTrackToPixelWithId(SOME_OTHER_PIXEL_ID, std::move(thirdTrack));
+        return sensorMessage;
+    }
+
+    PixelId const SOME_PIXEL_ID = 3;
+    PixelId const SOME_OTHER_PIXEL_ID = 7;
+    Track const SOME_TRACK = Track(2, 0, 135, 0, 110, 0);
+    Track const SOME_OTHER_TRACK = Track(14286, 0, 125, 0, 105, 0);
+};
+
+TEST_F(SparseFrameTest, given_aSensorMessageWithAFewTracks_when_compactInto_then_theFrameHoldsOnlyThePopulatedTracks) {
+    auto sensorMessage = createSensorMessageWithAFewTracks();
+    Frame frame;
+
+    sensorMessage.compactInto(frame);
+
+    ASSERT_EQ(3u, frame.numberOfTracks());
+    ASSERT_EQ(1u, frame.numberOfTracksIn(SOME_PIXEL_ID));
+    ASSERT_EQ(2u, frame.numberOfTracksIn(SOME_OTHER_PIXEL_ID));
+    ASSERT_EQ(SOME_OTHER_TRACK, frame.tracksOf(SOME_PIXEL_ID)[0].decode());
+    ASSERT_EQ(SOME_TRACK, frame.tracksOf(SOME_OTHER_PIXEL_ID)[0].decode());
+}
+
+TEST_F(SparseFrameTest, given_aCompactedSensorMessage_when_buildingASensorMessageFromTheFrame_then_equalsTheOriginal) {
+    auto sensorMessage = createSensorMessageWithAFewTracks();
+    Frame frame;
+    sensorMessage.compactInto(frame);
+
+    auto rebuiltSensorMessage = SensorMessage(sensorMessage.messageId, sensorMessage.sensorId, frame);
+
+    ASSERT_EQ(sensorMessage, rebuiltSensorMessage);
+}
+
+TEST_F(SparseFrameTest, given_aFrame_when_forEachTrack_then_visitsThePopulatedTracksInPixelOrder) {
+    auto frame = Frame(createSensorMessageWithAFewTracks().readPixels());
+    std::vector<PixelId> visitedPixelIds;
+    std::vector<Track> visitedTracks;
+
+    frame.forEachTrack([&visitedPixelIds, &visitedTracks](PixelId pixelId, Track const& track) {
+        visitedPixelIds.push_back(pixelId);
+        visitedTracks.push_back(track);
+    });
+
+    ASSERT_EQ(std::vector<PixelId>({SOME_PIXEL_ID, SOME_OTHER_PIXEL_ID, SOME_OTHER_PIXEL_ID}), visitedPixelIds);
+    ASSERT_EQ(std::vector<Track>({SOME_OTHER_TRACK, SOME_TRACK, SOME_OTHER_TRACK}), visitedTracks);
+}
+
+TEST_F(SparseFrameTest, given_twoFramesOfSensorMessagesWithDifferentTracks_when_checkingIfTheFramesAreEqual_then_returnsFalse) {
+    auto sensorMessage = createSensorMessageWithAFewTracks();
+    auto otherSensorMessage = createSensorMessageWithAFewTracks();
+    auto additionalTrack = Track(SOME_TRACK);
+    otherSensorMessage.addTrackToPixelWithId(SOME_PIXEL_ID, std::move(additionalTrack));
+
+    auto framesAreEqual = (Frame(sensorMessage.readPixels()) == Frame(otherSensorMessage.readPixels()));
+
+    ASSERT_FALSE(framesAreEqual);
+}
+
+TEST_F(SparseFrameTest,
+       given_aFrameEncodedInCentimeters_when_buildingASensorMessageFromTheFrame_then_equalsTheOriginalToTheCentimeter) {
+    using AWLFrame = DataFlow::SparseFrame<Sensor::AWL::_16::NUMBER_OF_PIXELS,
+            DataFlow::NumericEncoding::AWLTrackEncoding>;
+    auto sensorMessage = createSensorMessageWithAFewTracks();
+    auto additionalTrack = Track(7, 50, 12.344, -0.5, 1.251, -3.2);
+    sensorMessage.addTrackToPixelWithId(SOME_PIXEL_ID, std::move(additionalTrack));
+    auto frame = AWLFrame(sensorMessage.readPixels());
+    std::vector<Track> decodedTracks;
+
+    frame.forEachTrack([&decodedTracks](PixelId, Track const& track) {
+        decodedTracks.push_back(track);
+    });
+
+    ASSERT_EQ(SOME_OTHER_TRACK, decodedTracks[0]);
+    ASSERT_DOUBLE_EQ(12.34, decodedTracks[1].intensity);
+    ASSERT_DOUBLE_EQ(-0.5, decodedTracks[1].acceleration);
+    ASSERT_DOUBLE_EQ(1.25, decodedTracks[1].distance);
+    ASSERT_DOUBLE_EQ(-3.2, decodedTracks[1].speed);
+}
+
+#endif //SENSORGATEWAY_SPARSEFRAMETEST_CPP
@@ -8,7 +8,7 @@
 class TimeTrackingTest : public ::testing::Test {
 protected:
 
-    std::string const LOCATION = "The house of the Rose";
+    Metrics::LocationId const LOCATION = Metrics::Locations::SERVER_COMMUNICATOR_SENDING;
     static size_t const NUMBER_OF_SENSOR_TIMESTAMPS = 9;
     static size_t const NUMBER_OF_GATEWAY_TIMESTAMPS = 10;
 
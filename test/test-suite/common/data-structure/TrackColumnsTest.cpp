@@ -0,0 +1,121 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_TRACKCOLUMNSTEST_CPP
+#define SENSORGATEWAY_TRACKCOLUMNSTEST_CPP
+
+#include <gtest/gtest.h>
+
+#include "sensor-gateway/common/data-structure/sensor/AWLStructures.h"
+#include "sensor-gateway/common/data-structure/spirit/SensorMessage.hpp"
+#include "sensor-gateway/common/data-structure/spirit/TrackColumns.hpp"
+
+using SensorMessage = typename DataFlow::SensorMessage<Sensor::AWL::Structures::AWLMessageDefinition>;
+using DataFlow::Track;
+using DataFlow::PixelId;
+using DataFlow::TrackColumns;
+using DataFlow::TrackMask;
+
+namespace TrackKernels = DataFlow::TrackKernels;
+
+class TrackColumnsTest : public ::testing::Test {
+protected:
+
+    TrackColumnsTest() = default;
+
+    virtual ~TrackColumnsTest() = default;
+
+    TrackColumns createColumnsOfAFewTracks() const {
+        SensorMessage sensorMessage;
+        auto nearTrack = Track(NEAR_TRACK);
+        auto farTrack = Track(FAR_TRACK);
+        auto uncertainTrack = Track(UNCERTAIN_TRACK);
+        sensorMessage.addTrackToPixelWithId(SOME_PIXEL_ID, std::move(nearTrack));
+        sensorMessage.addTrackToPixelWithId(SOME_PIXEL_ID, std::move(farTrack));
+        sensorMessage.addTrackToPixelWithId(SOME_OTHER_PIXEL_ID, std::move(uncertainTrack));
+        TrackColumns columns;
+        columns.assign(sensorMessage);
+        return columns;
+    }
+
+    PixelId const SOME_PIXEL_ID = 2;
+    PixelId const SOME_OTHER_PIXEL_ID = 9;
+    Track const NEAR_TRACK = Track(1, 90, 2048, 0, 5, 1);
+    Track const FAR_TRACK = Track(2, 80, 4096, 0, 45, 2);
+    Track const UNCERTAIN_TRACK = Track(3, 10, 6144, 0, 20, 3);
+};
+
+TEST_F(TrackColumnsTest, given_aSensorMessage_when_assign_then_eachColumnHoldsTheFieldOfThePopulatedTracksInOrder) {
+    auto columns = createColumnsOfAFewTracks();
+
+    ASSERT_EQ(3u, columns.size());
+    ASSERT_EQ(std::vector<PixelId>({SOME_PIXEL_ID, SOME_PIXEL_ID, SOME_OTHER_PIXEL_ID}), columns.pixelIds);
+    ASSERT_EQ(std::vector<DataFlow::Distance>({5, 45, 20}), columns.distances);
+    ASSERT_EQ(FAR_TRACK, columns.trackAt(1));
+}
+
+TEST_F(TrackColumnsTest, given_theIntensityColumn_when_scaleWithAnOffset_then_everyIntensityIsConverted) {
+    auto columns = createColumnsOfAFewTracks();
+
+    TrackKernels::scale(columns.intensities, 1.0 / 2048, -21.0);
+
+    ASSERT_EQ(std::vector<DataFlow::Intensity>({-20, -19, -18}), columns.intensities);
+}
+
+TEST_F(TrackColumnsTest,
+       given_aDistanceRangeAndAMinimumConfidence_when_maskingThenKeepMasked_then_onlyTheTracksMeetingBothAreKept) {
+    auto columns = createColumnsOfAFewTracks();
+    TrackMask mask;
+
+    TrackKernels::maskWithin(columns.distances, 0.0, 30.0, mask);
+    auto numberOfMaskedTracks = TrackKernels::maskWithin(columns.confidenceLevels, DataFlow::ConfidenceLevel(50),
+                                                         DataFlow::ConfidenceLevel(100), mask);
+    columns.keepMasked(mask);
+
+    ASSERT_EQ(1u, numberOfMaskedTracks);
+    ASSERT_EQ(1u, columns.size());
+    ASSERT_EQ(NEAR_TRACK, columns.trackAt(0));
+}
+
+TEST_F(TrackColumnsTest, given_theDistanceColumn_when_findExtentAndBuildHistogram_then_returnsTheExtentAndTheCountPerBin) {
+    auto columns = createColumnsOfAFewTracks();
+
+    auto extent = TrackKernels::findExtent(columns.distances);
+    auto histogram = TrackKernels::buildHistogram<3>(columns.distances, 0.0, 10.0);
+
+    ASSERT_EQ(5, extent.minimum);
+    ASSERT_EQ(45, extent.maximum);
+    ASSERT_EQ((std::array<uint32_t, 3>({1, 0, 2})), histogram);
+}
+
+TEST_F(TrackColumnsTest, given_aNaNValue_when_buildHistogram_then_itIsNotCounted) {
+    std::vector<double> values = {5.0, std::numeric_limits<double>::quiet_NaN(), 25.0};
+
+    auto histogram = TrackKernels::buildHistogram<3>(values, 0.0, 10.0);
+
+    ASSERT_EQ((std::array<uint32_t, 3>({1, 0, 1})), histogram);
+}
+
+TEST_F(TrackColumnsTest, given_binsOfNullWidth_when_buildHistogram_then_countsTheValuesInTheFirstOrTheLastBin) {
+    std::vector<double> values = {-1.0, 0.0, 1.0};
+
+    auto histogram = TrackKernels::buildHistogram<3>(values, 0.0, 0.0);
+
+    ASSERT_EQ((std::array<uint32_t, 3>({2, 0, 1})), histogram);
+}
+
+#endif //SENSORGATEWAY_TRACKCOLUMNSTEST_CPP
@@ -33,7 +33,8 @@ using AWL16Structures = Sensor::AWL::Structures;
 using AWL16SpiritStructures = Sensor::Spirit::Structures<
         AWL16Structures::AWLMessageDefinition,
         AWL16Structures::AWLRawDataDefinition,
-        AWL16Structures::AWLCommandDefinition
+        AWL16Structures::AWLCommandDefinition,
+        DataFlow::NumericEncoding::AWLTrackEncoding
 >;
 
 using AWLMessage = AWL16Structures::Message;
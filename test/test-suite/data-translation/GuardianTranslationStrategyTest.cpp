@@ -174,6 +174,30 @@ TEST_F(GuardianTranslationStrategyTest,
     ASSERT_EQ(expectedSpiritMessage, actualSpiritMessage);
 }
 
+TEST_F(GuardianTranslationStrategyTest,
+       given_aDetectionTrackOfAPreviousFrame_when_translatingItsDetectionVelocityMessage_then_theNextFrameIsLeftUnchanged) {
+
+    auto detectionTrackAWLMessage = SOME_DETECTION_TRACK_AWL_MESSAGE;
+    auto firstEndOfSpiritMessageAWLMessage = SOME_END_FRAME_AWL_MESSAGE;
+    auto detectionVelocityAWLMessage = SOME_VELOCITY_TRACK_AWL_MESSAGE;
+    auto secondEndOfSpiritMessageAWLMessage = SOME_END_FRAME_AWL_MESSAGE;
+    auto expectedSpiritMessage = FRAME_AFTER_END_OF_FRAME_MESSAGE_TRANSLATION;
+    GuardianTranslationStrategy translationStrategy;
+    SpiritMessageSinkMock sensorMessageSinkMock(2);
+    SpiritMessageProcessingScheduler scheduler(&sensorMessageSinkMock);
+    translationStrategy.linkConsumer(&scheduler);
+
+    translationStrategy.translateMessage(std::move(detectionTrackAWLMessage));
+    translationStrategy.translateMessage(std::move(firstEndOfSpiritMessageAWLMessage));
+    translationStrategy.translateMessage(std::move(detectionVelocityAWLMessage));
+    translationStrategy.translateMessage(std::move(secondEndOfSpiritMessageAWLMessage));
+
+    sensorMessageSinkMock.waitConsumptionToBeReached();
+    scheduler.terminateAndJoin();
+    auto actualSpiritMessage = sensorMessageSinkMock.getConsumedData().back();
+    ASSERT_EQ(expectedSpiritMessage, actualSpiritMessage);
+}
+
 TEST_F(GuardianTranslationStrategyTest,
        given_someEndOfSpiritMessageAWLMessage_when_translatingThisMessage_then_callsProduceOneTime) {
 
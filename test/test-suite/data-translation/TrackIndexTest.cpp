@@ -0,0 +1,93 @@
+/**
+	Copyright 2014-2018 Phantom Intelligence Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+*/
+
+
+#ifndef SENSORGATEWAY_TRACKINDEXTEST_CPP
+#define SENSORGATEWAY_TRACKINDEXTEST_CPP
+
+#include <gtest/gtest.h>
+#include "sensor-gateway/data-translation/TrackIndex.hpp"
+
+using DataFlow::TrackId;
+using DataFlow::PixelId;
+
+class TrackIndexTest : public ::testing::Test {
+protected:
+
+    TrackIndexTest() = default;
+
+    virtual ~TrackIndexTest() = default;
+
+    static auto const MAXIMUM_NUMBER_OF_TRACKS = 8u;
+    using SmallTrackIndex = DataTranslation::TrackIndex<MAXIMUM_NUMBER_OF_TRACKS>;
+
+    TrackId const SOME_TRACK_ID = 14291;
+    PixelId const SOME_PIXEL_ID = 11;
+    SmallTrackIndex::TrackSlot const SOME_SLOT = 3;
+};
+
+TEST_F(TrackIndexTest, given_aRecordedTrack_when_find_then_returnsItsPixelAndSlot) {
+    SmallTrackIndex trackIndex;
+    trackIndex.record(SOME_TRACK_ID, SOME_PIXEL_ID, SOME_SLOT);
+
+    auto location = trackIndex.find(SOME_TRACK_ID);
+
+    ASSERT_NE(nullptr, location);
+    ASSERT_EQ(SOME_PIXEL_ID, location->pixelId);
+    ASSERT_EQ(SOME_SLOT, location->slot);
+}
+
+TEST_F(TrackIndexTest, given_aRecordedTrack_when_clearThenFind_then_returnsNull) {
+    SmallTrackIndex trackIndex;
+    trackIndex.record(SOME_TRACK_ID, SOME_PIXEL_ID, SOME_SLOT);
+
+    trackIndex.clear();
+
+    ASSERT_EQ(nullptr, trackIndex.find(SOME_TRACK_ID));
+}
+
+TEST_F(TrackIndexTest, given_aFullFrameOfCollidingIds_when_find_then_returnsTheLocationOfEachOfThem) {
+    SmallTrackIndex trackIndex;
+    auto const idStrideMappingOnTheSameEntry = 1024u;
+    for (auto trackIndexInFrame = 0u; trackIndexInFrame < MAXIMUM_NUMBER_OF_TRACKS; ++trackIndexInFrame) {
+        auto trackId = static_cast<TrackId>(trackIndexInFrame * idStrideMappingOnTheSameEntry);
+        trackIndex.record(trackId, static_cast<PixelId>(trackIndexInFrame), SOME_SLOT);
+    }
+
+    for (auto trackIndexInFrame = 0u; trackIndexInFrame < MAXIMUM_NUMBER_OF_TRACKS; ++trackIndexInFrame) {
+        auto trackId = static_cast<TrackId>(trackIndexInFrame * idStrideMappingOnTheSameEntry);
+        auto location = trackIndex.find(trackId);
+        ASSERT_NE(nullptr, location);
+        ASSERT_EQ(trackIndexInFrame, location->pixelId);
+    }
+    ASSERT_EQ(nullptr, trackIndex.find(SOME_TRACK_ID));
+    ASSERT_EQ(0u, trackIndex.fetchNumberOfDroppedRecords());
+}
+
+TEST_F(TrackIndexTest, given_aFullTable_when_recordingAnotherTrack_then_itIsDroppedAndCounted) {
+    SmallTrackIndex trackIndex;
+    auto const numberOfEntries = 2 * MAXIMUM_NUMBER_OF_TRACKS;
+    for (auto trackId = 0u; trackId < numberOfEntries; ++trackId) {
+        trackIndex.record(static_cast<TrackId>(trackId), SOME_PIXEL_ID, SOME_SLOT);
+    }
+
+    trackIndex.record(SOME_TRACK_ID, SOME_PIXEL_ID, SOME_SLOT);
+
+    ASSERT_EQ(nullptr, trackIndex.find(SOME_TRACK_ID));
+    ASSERT_EQ(1u, trackIndex.fetchNumberOfDroppedRecords());
+}
+
+#endif //SENSORGATEWAY_TRACKINDEXTEST_CPP
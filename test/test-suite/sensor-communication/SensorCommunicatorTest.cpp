@@ -22,6 +22,7 @@
 
 #include "sensor-gateway/sensor-communication/SensorCommunicator.hpp"
 #include "test/utilities/mock/ArbitraryDataSinkMock.hpp"
+#include "test/utilities/mock/ConsumerLinkMock.h"
 #include "test/utilities/mock/ErrorThrowingSensorCommunicationStrategyMock.hpp"
 
 using SimpleMessage = Sensor::Test::Simple::Structures::Message;
@@ -53,6 +54,8 @@ namespace SensorCommunicatorTestMock {
                 closeConnectionCalled(false),
                 fetchMessagesCalled(false),
                 fetchRawDataCyclesCalled(false),
+                numberOfFetchMessagesCalls(0),
+                numberOfFetchRawDataCyclesCalls(0),
                 sendCommandCalled(false),
                 fetchMessagesCalledBeforeFetchRawDataCycles(false),
                 fetchRawDataCyclesCalledBeforeSendCommand(false),
@@ -137,6 +140,14 @@ namespace SensorCommunicatorTestMock {
             return fetchRawDataCyclesCalled.load();
         }
 
+        uint32_t getNumberOfFetchMessagesCalls() const {
+            return numberOfFetchMessagesCalls.load();
+        }
+
+        uint32_t getNumberOfFetchRawDataCyclesCalls() const {
+            return numberOfFetchRawDataCyclesCalls.load();
+        }
+
         bool hasMessageAndRawDataCallSequenceBeenRespected() const {
             bool sequenceRespected =
                     hasFetchMessagesBeenCalled() &&
@@ -164,6 +175,7 @@ namespace SensorCommunicatorTestMock {
     private:
 
         void acknowledgeFetchMessagesHasBeenCalled() {
+            ++numberOfFetchMessagesCalls;
             LockGuard sequenceGuard(callSequenceMutex);
             LockGuard guard(fetchMessagesAckMutex);
             if (!hasFetchMessagesBeenCalled()) {
@@ -176,6 +188,7 @@ namespace SensorCommunicatorTestMock {
         }
 
         void acknowledgeFetchRawDataCyclesHasBeenCalled() {
+            ++numberOfFetchRawDataCyclesCalls;
             LockGuard sequenceGuard(callSequenceMutex);
             LockGuard guard(fetchRawDataCyclesAckMutex);
             if (!hasFetchRawDataCyclesBeenCalled()) {
@@ -193,6 +206,9 @@ namespace SensorCommunicatorTestMock {
         AtomicFlag fetchRawDataCyclesCalled;
         AtomicFlag sendCommandCalled;
 
+        std::atomic<uint32_t> numberOfFetchMessagesCalls;
+        std::atomic<uint32_t> numberOfFetchRawDataCyclesCalls;
+
         Mutex callSequenceMutex;
         AtomicFlag fetchMessagesCalledBeforeFetchRawDataCycles;
         AtomicFlag fetchRawDataCyclesCalledBeforeSendCommand;
@@ -451,6 +467,27 @@ TEST_F(SensorCommunicatorTest, given__when_start_then_callsFetchMessagesBeforeFe
     ASSERT_TRUE(sequenceRespected);
 }
 
+TEST_F(SensorCommunicatorTest, given_aRawDataConsumerFallingBehind_when_start_then_pollsRawDataLessOftenThanMessages) {
+    uint32_t const numberOfMessagesFetchesToWaitFor = 20 * DataFlow::RAW_DATA_POLLING_DECIMATION_UNDER_BACK_PRESSURE;
+    SensorCommunicatorTestMock::SensorCommunicationStrategy mockStrategy;
+    SimpleMessageSensorCommunicator sensorCommunicator(&mockStrategy);
+    Mock::ConsumerLinkMock<SimpleRawData> rawDataConsumer;
+    rawDataConsumer.fallBehind(true);
+    sensorCommunicator.linkConsumer(&rawDataConsumer);
+
+    sensorCommunicator.start();
+    while (mockStrategy.getNumberOfFetchMessagesCalls() < numberOfMessagesFetchesToWaitFor) {
+        std::this_thread::yield();
+    }
+    sensorCommunicator.terminateAndJoin();
+
+    auto numberOfMessagesFetches = mockStrategy.getNumberOfFetchMessagesCalls();
+    auto numberOfRawDataFetches = mockStrategy.getNumberOfFetchRawDataCyclesCalls();
+    ASSERT_GT(numberOfRawDataFetches, 0u);
+    ASSERT_LE(numberOfRawDataFetches,
+              numberOfMessagesFetches / DataFlow::RAW_DATA_POLLING_DECIMATION_UNDER_BACK_PRESSURE + 1);
+}
+
 using SimpleMessageProcessingScheduler = DataFlow::DataProcessingScheduler<SimpleMessage, SimpleMessageSinkMock, 1>;
 
 SimpleMessageList SensorCommunicatorTest::fetchMessageProducedBySensorCommunicatorExecution(
@@ -212,7 +212,7 @@ TEST_F(ServerCommunicatorTest, given_aMessageToSend_when_consume_then_sendsItAft
     auto timePointLocation = timePoint.location;
     auto timePointTimestamp = timePoint.timestamp;
 
-    auto sameLocation = timePointLocation == Metrics::LocationNames::SERVER_COMMUNICATOR_SENDING;
+    auto sameLocation = timePointLocation == Metrics::Locations::SERVER_COMMUNICATOR_SENDING;
     ASSERT_TRUE(sameLocation);
     ASSERT_TRUE(Assert::timeWithinMicrosecondDelta(timePointTimestamp, now, FIVE_HUNDRED_NANO_SECONDS));
 }
@@ -85,14 +85,18 @@ std::string SimpleMessage::toString() const noexcept {
     return stringifiedContent;
 }
 
-void SimpleMessage::addTimePointForGatewayWithLocation(std::string const& locationName) {
-    gatewayTimestamps.addTimePointForLocation(locationName);
+void SimpleMessage::addTimePointForGatewayWithLocation(Metrics::LocationId const& location) {
+    gatewayTimestamps.addTimePointForLocation(location);
 }
 
 SimpleMessage::ServiceTimestamps const& SimpleMessage::getGatewayTimestamps() const noexcept {
     return gatewayTimestamps;
 }
 
+SimpleMessage::Content const& SimpleMessage::getContent() const noexcept {
+    return content;
+}
+
 const SimpleMessage SimpleMessage::returnDefaultData() noexcept {
     return Defaults::DEFAULT_SIMPLE_MESSAGE;
 }
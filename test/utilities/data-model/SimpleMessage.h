@@ -62,10 +62,12 @@ namespace DataModel {
 
         std::string toString() const noexcept;
 
-        void addTimePointForGatewayWithLocation(std::string const& locationName);
+        void addTimePointForGatewayWithLocation(Metrics::LocationId const& location);
 
         ServiceTimestamps const& getGatewayTimestamps() const noexcept;
 
+        Content const& getContent() const noexcept;
+
         SimpleMessage static const returnDefaultData() noexcept;
 
     private:
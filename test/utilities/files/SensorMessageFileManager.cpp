@@ -43,20 +43,19 @@ void SensorMessageFileManager::writeFileBlockWithMessage(TestUtilities::Structur
     writeFileLineWithContentLabelAndValue(file, 0, MESSAGE_ID_LABEL.c_str(), message.messageId);
     writeFileLineWithContentLabelAndValue(file, 0, SENSOR_ID_LABEL.c_str(), message.sensorId);
 
-    auto pixels = message.getPixels();
+    auto const& pixels = message.readPixels();
     writeFileLineWithContentLabel(file, 0, PIXELS_LABEL.c_str());
-    for (auto pixel : *pixels) {
+    for (auto const& pixel : pixels) {
         writeFileLineWithContentLabelAndValue(file, 1, PIXEL_ID_LABEL.c_str(), pixel.id);
         writeFileLineWithContentLabel(file, 2, TRACKS_LABEL.c_str());
-        auto tracks = pixel.getTracks();
-        for (auto track : *tracks) {
+        pixel.forEachTrack([this, file](DataFlow::Track const& track) {
             writeFileLineWithContentLabelAndValue(file, 3, TRACK_ID_LABEL.c_str(), track.id);
             writeFileLineWithContentLabelAndValue(file, 4, ACCELERATION_LABEL.c_str(), track.acceleration);
             writeFileLineWithContentLabelAndValue(file, 4, DISTANCE_LABEL.c_str(), track.distance);
             writeFileLineWithContentLabelAndValue(file, 4, INTENSITY_LABEL.c_str(), track.intensity);
             writeFileLineWithContentLabelAndValue(file, 4, CONFIDENCE_LEVEL_LABEL.c_str(), track.confidenceLevel);
             writeFileLineWithContentLabelAndValue(file, 4, SPEED_LABEL.c_str(), track.speed);
-        }
+        });
     }
     std::fprintf(file, "%s\n", MESSAGES_SEPARATOR.c_str());
 }
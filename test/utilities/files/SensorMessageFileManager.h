@@ -30,7 +30,8 @@ namespace TestUtilities {
         using AWL16SpiritStructures = Sensor::Spirit::Structures<
                 AWL16Structures::AWLMessageDefinition,
                 AWL16Structures::AWLRawDataDefinition,
-                AWL16Structures::AWLCommandDefinition
+                AWL16Structures::AWLCommandDefinition,
+                DataFlow::NumericEncoding::AWLTrackEncoding
         >;
         using Message = AWL16SpiritStructures::Message;
         using SensorMessages = std::array<Message, MAX_NUMBER_OF_SENSOR_MESSAGES_CURRENTLY_NEEDED_FOR_TEST>;
@@ -26,11 +26,11 @@ namespace Mock {
 
     protected:
 
-        using Buffer = DataFlow::RingBuffer<DATA>;
+        using Buffer = DataFlow::AbstractRingBuffer<DATA>;
 
     public:
 
-        ConsumerLinkMock() : active(false) {}
+        ConsumerLinkMock() : active(false), fallingBehind(false) {}
 
         void linkWith(Buffer* buffer) {
             buffer->linkWith(this);
@@ -48,9 +48,18 @@ namespace Mock {
             return active;
         }
 
+        bool isFallingBehind() const noexcept override {
+            return fallingBehind;
+        }
+
+        void fallBehind(bool isFallingBehind) noexcept {
+            fallingBehind = isFallingBehind;
+        }
+
     private:
 
         bool active;
+        bool fallingBehind;
     };
 }
 
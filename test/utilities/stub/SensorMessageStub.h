@@ -27,7 +27,8 @@ namespace Stub {
     using AWL16SpiritStructures = Sensor::Spirit::Structures<
             AWL16Structures::AWLMessageDefinition,
             AWL16Structures::AWLRawDataDefinition,
-            AWL16Structures::AWLCommandDefinition
+            AWL16Structures::AWLCommandDefinition,
+            DataFlow::NumericEncoding::AWLTrackEncoding
     >;
     using SensorMessage = AWL16SpiritStructures::Message;
     using DataFlow::MessageId;